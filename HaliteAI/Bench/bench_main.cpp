@@ -0,0 +1,502 @@
+#include "bench_state.hpp"
+#include "HaliteAI/Bot/map_utils.hpp"
+#include "HaliteAI/Bot/traffic_manager.hpp"
+#include "HaliteAI/Bot/turn_arena.hpp"
+#include "HaliteAI/Sim/simulator.hpp"
+#include "HaliteAI/Tools/tool_args.hpp"
+#include "hlt/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// ALLOCATIONS
+
+// Compteur global des allocations : tout new du process passe par ici
+static std::atomic<uint64_t> g_allocations{0};
+
+static void *counted_alloc(size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size) { return counted_alloc(size); }
+void *operator new[](size_t size) { return counted_alloc(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// Temps et allocations des sections mesurees d'un benchmark
+    class Meter
+    {
+    public:
+        void begin()
+        {
+            m_allocations_start = g_allocations.load(std::memory_order_relaxed);
+            m_start = Clock::now();
+        }
+
+        void end(uint64_t ops)
+        {
+            auto stop = Clock::now();
+            m_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - m_start).count());
+            m_allocations += g_allocations.load(std::memory_order_relaxed) - m_allocations_start;
+            m_ops += ops;
+        }
+
+        uint64_t ns() const { return m_ns; }
+        uint64_t ops() const { return m_ops; }
+        uint64_t allocations() const { return m_allocations; }
+
+    private:
+        Clock::time_point m_start;
+        uint64_t m_allocations_start = 0;
+        uint64_t m_ns = 0;
+        uint64_t m_ops = 0;
+        uint64_t m_allocations = 0;
+    };
+
+    struct BenchResult
+    {
+        std::string name;
+        int map_size;
+        int fleet;
+        double ns_per_op;
+        double allocs_per_op;
+    };
+
+    using BenchKey = std::tuple<std::string, int, int>;
+
+    /// Un kernel : une iteration mesure une ou plusieurs ops via le Meter
+    struct Kernel
+    {
+        const char *name;
+        std::function<void(bench::BenchState &, Meter &)> iteration;
+    };
+
+    std::vector<Kernel> make_kernels()
+    {
+        std::vector<Kernel> kernels;
+
+        kernels.push_back({"compute_heatmap", [](bench::BenchState &state, Meter &meter) {
+                               meter.begin();
+                               state.blackboard->compute_heatmap(*state.game->game_map);
+                               meter.end(1);
+                           }});
+
+        // Le clear fait partie du cout d'un tour (clear_turn_data)
+        kernels.push_back({"compute_inspired_zones", [](bench::BenchState &state, Meter &meter) {
+                               const hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               state.blackboard->inspired_zones.clear();
+                               state.blackboard->compute_inspired_zones(map.width, map.height);
+                               meter.end(1);
+                           }});
+
+        kernels.push_back({"threat_field", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               bb.threat_field.build(bb.enemy_ships, map.width, map.height, bb.params.flee_threat_radius + 1);
+                               meter.end(1);
+                           }});
+
+        kernels.push_back({"enemy_tracker", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               bb.enemy_tracker.update(bb.enemy_ships, bb.allied_positions, map.width, map.height);
+                               meter.end(1);
+                           }});
+
+        kernels.push_back({"enemy_moves", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               bb.enemy_moves.build(bb.enemy_ships, bb.enemy_tracker, map,
+                                                    bb.average_halite, bb.danger_cargo);
+                               meter.end(1);
+                           }});
+
+        kernels.push_back({"contention", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               bb.contention.build(bb.enemy_ships, map, bb.average_halite / hlt::constants::MOVE_COST_RATIO,
+                                                   bb.danger_cargo);
+                               meter.end(1);
+                           }});
+
+        // Une op = un ship
+        kernels.push_back({"find_best_explore_target", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               bb.turn_budget.start_turn();
+                               meter.begin();
+                               for (const auto &ship : state.my_ships)
+                               {
+                                   int score = 0;
+                                   bb.find_best_explore_target(map, ship->position, ship->id, ship->halite,
+                                                               bb.drop_positions, score);
+                               }
+                               meter.end(state.my_ships.size());
+                           }});
+
+        kernels.push_back({"find_best_dropoff_position", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               const hlt::GameMap &map = *state.game->game_map;
+                               int min_depot_distance = std::max(8, map.width / bb.params.min_dropoff_depot_distance_ratio);
+                               bb.turn_budget.start_turn();
+                               meter.begin();
+                               bb.find_best_dropoff_position(map, bb.drop_positions, min_depot_distance);
+                               meter.end(1);
+                           }});
+
+        // Une op = un ship
+        kernels.push_back({"navigate_toward", [](bench::BenchState &state, Meter &meter) {
+                               bot::Blackboard &bb = *state.blackboard;
+                               hlt::GameMap &map = *state.game->game_map;
+                               meter.begin();
+                               for (size_t i = 0; i < state.my_ships.size(); ++i)
+                               {
+                                   hlt::Direction best_dir;
+                                   bot::DirectionList alternatives;
+                                   bot::map_utils::navigate_toward(*state.my_ships[i], map, state.explore_targets[i],
+                                                                   bb.stuck_positions, bb.danger_zones,
+                                                                   bb.enemy_moves, bb.params.danger_occupancy,
+                                                                   best_dir, alternatives);
+                               }
+                               meter.end(state.my_ships.size());
+                           }});
+
+        // resolve_all modifie les priorites : copie hors mesure
+        kernels.push_back({"resolve_all", [](bench::BenchState &state, Meter &meter) {
+                               static bot::TrafficManager traffic;
+                               bot::Blackboard &bb = *state.blackboard;
+                               bot::MoveRequests requests = state.move_requests;
+                               bb.turn_budget.start_turn();
+                               traffic.init(*state.game->game_map, bb.drop_positions, state.game->me->ships, 200,
+                                            bb.params, bb.turn_budget);
+                               meter.begin();
+                               traffic.resolve_all(requests);
+                               meter.end(1);
+                           }});
+
+        return kernels;
+    }
+
+    /// Une iteration dans une arena remise a zero, comme un tour de BotPlayer::play_turn :
+    /// les conteneurs transitoires n'allouent plus sur le heap apres la chauffe
+    void run_iteration(const Kernel &kernel, bench::BenchState &state, Meter &meter)
+    {
+        static bot::TurnArena arena;
+        arena.reset();
+        bot::TurnArena::Scope arena_scope(&arena);
+        kernel.iteration(state, meter);
+    }
+
+    /// Repete le kernel jusqu'a min_ms de temps mesure (une iteration de chauffe)
+    BenchResult run_kernel(const Kernel &kernel, bench::BenchState &state, int map_size, int fleet, double min_ms)
+    {
+        Meter warmup;
+        run_iteration(kernel, state, warmup);
+
+        Meter meter;
+        uint64_t min_ns = static_cast<uint64_t>(min_ms * 1e6);
+        while (meter.ns() < min_ns || meter.ops() == 0)
+            run_iteration(kernel, state, meter);
+
+        double ops = static_cast<double>(meter.ops());
+        return BenchResult{kernel.name, map_size, fleet, meter.ns() / ops, meter.allocations() / ops};
+    }
+
+    /// Allocations du heap des play_turn d'un joueur sur une partie simulee
+    struct TurnAllocations
+    {
+        int map_size;
+        int turns;           // Tours en regime permanent mesures
+        int turns_with_allocs;
+        uint64_t max_allocs; // Pire tour en regime permanent
+    };
+
+    /// Partie 2 joueurs sur le simulateur, le joueur 0 est mesure. Un tour est en regime permanent
+    /// apres TURN_ALLOCS_WARMUP tours si aucun joueur ne depasse son pic de ships ou de dropoffs et
+    /// qu'aucun id de ship n'est nouveau max : les buffers du bot ont deja leur taille, le tour
+    /// ne doit rien allouer (la taille de l'arena suit le pic, cf. TurnArena::reset)
+    TurnAllocations measure_turn_allocations(int map_size, uint64_t seed, size_t decision_workers)
+    {
+        constexpr int TURN_ALLOCS_WARMUP = 20;
+        constexpr int NUM_PLAYERS = 2;
+
+        sim::set_default_constants(map_size);
+        sim::GameConfig config;
+        config.width = map_size;
+        config.height = map_size;
+        config.num_players = NUM_PLAYERS;
+        config.seed = seed;
+
+        sim::Simulator simulator(config);
+        std::vector<std::unique_ptr<hlt::Game>> games;
+        std::vector<std::unique_ptr<bot::BotPlayer>> bots;
+        for (int p = 0; p < NUM_PLAYERS; ++p)
+        {
+            games.push_back(simulator.make_view(p));
+            bots.push_back(std::unique_ptr<bot::BotPlayer>(
+                new bot::BotPlayer(*games.back(), bot::BotParams(), decision_workers)));
+        }
+
+        TurnAllocations result{map_size, 0, 0, 0};
+        std::vector<size_t> fleet_peaks(NUM_PLAYERS, 0);
+        std::vector<size_t> depot_peaks(NUM_PLAYERS, 0);
+        hlt::EntityId max_ship_id = -1;
+        while (!simulator.is_over())
+        {
+            for (int p = 0; p < NUM_PLAYERS; ++p)
+            {
+                simulator.sync_view(*games[p]);
+
+                bool growth = false;
+                for (const auto &player : games[p]->players)
+                {
+                    size_t fleet = player->ships.size();
+                    if (fleet > fleet_peaks[player->id])
+                    {
+                        fleet_peaks[player->id] = fleet;
+                        growth = true;
+                    }
+                    size_t depots = player->dropoffs.size();
+                    if (depots > depot_peaks[player->id])
+                    {
+                        depot_peaks[player->id] = depots;
+                        growth = true;
+                    }
+                    for (const auto &ship : player->ships)
+                    {
+                        if (ship.id > max_ship_id)
+                        {
+                            max_ship_id = ship.id;
+                            growth = true;
+                        }
+                    }
+                }
+
+                uint64_t before = g_allocations.load(std::memory_order_relaxed);
+                const std::vector<hlt::Command> &commands = bots[p]->play_turn();
+                uint64_t allocs = g_allocations.load(std::memory_order_relaxed) - before;
+
+                if (p == 0 && simulator.turn() > TURN_ALLOCS_WARMUP && !growth)
+                {
+                    ++result.turns;
+                    if (allocs > 0)
+                        ++result.turns_with_allocs;
+                    result.max_allocs = std::max(result.max_allocs, allocs);
+                }
+
+                simulator.submit(static_cast<hlt::PlayerId>(p), commands);
+            }
+            simulator.step();
+        }
+        return result;
+    }
+
+    std::map<BenchKey, BenchResult> load_baseline(const std::string &path)
+    {
+        std::map<BenchKey, BenchResult> baseline;
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream fields(line);
+            BenchResult result;
+            if (fields >> result.name >> result.map_size >> result.fleet >> result.ns_per_op >> result.allocs_per_op)
+                baseline[BenchKey(result.name, result.map_size, result.fleet)] = result;
+        }
+        return baseline;
+    }
+
+    void write_results(const std::vector<BenchResult> &results, const std::map<BenchKey, BenchResult> &baseline,
+                       std::ostream &out)
+    {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-28s %4s %5s %14s %12s %9s %10s\n", "# kernel", "map", "fleet", "ns/op",
+                      "allocs/op", "d_ns", "d_allocs");
+        out << line;
+
+        for (const auto &result : results)
+        {
+            auto it = baseline.find(BenchKey(result.name, result.map_size, result.fleet));
+            char delta_ns[32] = "-";
+            char delta_allocs[32] = "-";
+            if (it != baseline.end())
+            {
+                if (it->second.ns_per_op > 0)
+                    std::snprintf(delta_ns, sizeof(delta_ns), "%+.1f%%",
+                                  100.0 * (result.ns_per_op / it->second.ns_per_op - 1.0));
+                std::snprintf(delta_allocs, sizeof(delta_allocs), "%+.2f",
+                              result.allocs_per_op - it->second.allocs_per_op);
+            }
+
+            std::snprintf(line, sizeof(line), "%-28s %4d %5d %14.1f %12.2f %9s %10s\n", result.name.c_str(),
+                          result.map_size, result.fleet, result.ns_per_op, result.allocs_per_op, delta_ns, delta_allocs);
+            out << line;
+        }
+    }
+
+    void save_baseline(const std::vector<BenchResult> &results, const std::string &path)
+    {
+        std::ofstream out(path);
+        out << "# kernel map fleet ns_per_op allocs_per_op\n";
+        for (const auto &result : results)
+            out << result.name << " " << result.map_size << " " << result.fleet << " " << result.ns_per_op << " "
+                << result.allocs_per_op << "\n";
+    }
+
+    void usage()
+    {
+        std::cerr << "Usage: bench [--sizes 32,48,64] [--fleets 10,100,400] [--filter nom] [--min-ms T] [--seed S]\n"
+                     "             [--out fichier] [--baseline fichier] [--save-baseline fichier]\n"
+                     "       bench --turn-allocs [--sizes 32,48,64] [--seed S] [--workers N]\n";
+    }
+
+    /// Mode --turn-allocs : echec si un tour en regime permanent alloue sur le heap
+    int run_turn_allocations(const std::vector<int> &sizes, uint64_t seed, size_t decision_workers)
+    {
+        // Logs coupes comme en tournoi : un message construit alloue
+        hlt::log::set_enabled(false);
+
+        bool ok = true;
+        std::printf("%-4s %6s %12s %10s\n", "map", "turns", "alloc_turns", "max_allocs");
+        for (int size : sizes)
+        {
+            TurnAllocations result = measure_turn_allocations(size, seed, decision_workers);
+            std::printf("%-4d %6d %12d %10llu\n", result.map_size, result.turns, result.turns_with_allocs,
+                        static_cast<unsigned long long>(result.max_allocs));
+            ok = ok && result.turns_with_allocs == 0;
+        }
+        return ok ? 0 : 1;
+    }
+} // namespace
+
+// Microbenchmarks des kernels du bot sur des etats synthetiques seedes.
+// Compare au fichier baseline (ns/op en %, allocs/op en absolu) et ecrit le tableau dans --out
+// La baseline depend de la machine : elle est rafraichie (--save-baseline) dans un commit a part,
+// jamais avec un changement de code, pour que chaque changement se lise en d_ns / d_allocs
+int main(int argc, char *argv[])
+{
+    std::vector<int> sizes{32, 40, 48, 56, 64};
+    std::vector<int> fleets{10, 50, 100, 200, 400};
+    std::string filter;
+    double min_ms = 50.0;
+    uint64_t seed = 1;
+    std::string out_path = "bench_output.txt";
+#ifdef BENCH_BASELINE_PATH
+    std::string baseline_path = BENCH_BASELINE_PATH;
+#else
+    std::string baseline_path;
+#endif
+    std::string save_path;
+    bool turn_allocs = false;
+    size_t decision_workers = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--sizes") == 0 && has_value)
+            sizes = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--fleets") == 0 && has_value)
+            fleets = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--filter") == 0 && has_value)
+            filter = argv[++i];
+        else if (std::strcmp(argv[i], "--min-ms") == 0 && has_value)
+            min_ms = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && has_value)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--out") == 0 && has_value)
+            out_path = argv[++i];
+        else if (std::strcmp(argv[i], "--baseline") == 0 && has_value)
+            baseline_path = argv[++i];
+        else if (std::strcmp(argv[i], "--save-baseline") == 0 && has_value)
+            save_path = argv[++i];
+        else if (std::strcmp(argv[i], "--turn-allocs") == 0)
+            turn_allocs = true;
+        else if (std::strcmp(argv[i], "--workers") == 0 && has_value)
+            decision_workers = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (turn_allocs)
+        return run_turn_allocations(sizes, seed, decision_workers);
+
+    std::vector<Kernel> kernels = make_kernels();
+    std::vector<BenchResult> results;
+
+    for (int size : sizes)
+    {
+        for (int fleet : fleets)
+        {
+            std::unique_ptr<bench::BenchState> state = bench::make_bench_state(size, fleet, seed);
+            for (const auto &kernel : kernels)
+            {
+                if (!filter.empty() && std::string(kernel.name).find(filter) == std::string::npos)
+                    continue;
+                results.push_back(run_kernel(kernel, *state, size, fleet, min_ms));
+            }
+        }
+    }
+
+    // Tri par kernel pour lire l'evolution avec la taille
+    std::stable_sort(results.begin(), results.end(),
+                     [](const BenchResult &a, const BenchResult &b) { return a.name < b.name; });
+
+    std::map<BenchKey, BenchResult> baseline;
+    if (!baseline_path.empty())
+        baseline = load_baseline(baseline_path);
+
+    write_results(results, baseline, std::cout);
+
+    std::ofstream out(out_path);
+    write_results(results, baseline, out);
+
+    if (!save_path.empty())
+        save_baseline(results, save_path);
+
+    return out ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+#include "bench_state.hpp"
+#include "HaliteAI/Bot/map_utils.hpp"
+#include "HaliteAI/Sim/rng.hpp"
+#include "HaliteAI/Sim/simulator.hpp"
+#include "HaliteAI/Sim/state_generator.hpp"
+#include "hlt/constants.hpp"
+
+#include <algorithm>
+
+namespace bench
+{
+    namespace
+    {
+        constexpr int NUM_PLAYERS = 2;
+        constexpr double BENCH_PROGRESS = 0.5;
+
+        // Equivalent de BotPlayer::update_blackboard sur l'etat genere
+        void fill_blackboard(bot::Blackboard &bb, hlt::Game &game)
+        {
+            hlt::GameMap &map = *game.game_map;
+            const hlt::Player &me = *game.me;
+
+            bb.resize_turn_layers(map.width, map.height);
+            bb.clear_turn_data();
+            bb.total_ships_alive = static_cast<int>(me.ships.size());
+            bb.drop_positions.push_back(me.shipyard.position);
+            for (const auto &dropoff : me.dropoffs)
+                bb.drop_positions.push_back(dropoff.position);
+
+            bb.allied_positions.clear();
+            for (const auto &ship : me.ships)
+                bb.allied_positions.push_back(ship.position);
+
+            long long total_halite = 0;
+            for (const auto &row : map.cells)
+                for (const auto &cell : row)
+                    total_halite += cell.halite;
+            bb.average_halite = static_cast<int>(total_halite / (map.width * map.height));
+            bb.current_phase = bot::GamePhase::MID;
+
+            std::vector<hlt::Position> depots;
+            for (const auto &player : game.players)
+            {
+                if (player->id == game.my_id)
+                    continue;
+
+                // Depot le plus proche parmi shipyard et dropoffs, comme update_enemy_info
+                depots.clear();
+                depots.push_back(player->shipyard.position);
+                for (const auto &dropoff : player->dropoffs)
+                    depots.push_back(dropoff.position);
+
+                for (const auto &ship : player->ships)
+                {
+                    hlt::Position pos = ship.position;
+                    hlt::Position depot = bot::map_utils::closest_position(pos, depots, map.width, map.height);
+                    bb.enemy_ships.push_back({ship.id, pos, ship.halite, player->id, depot});
+                    bb.danger_zones.insert(pos);
+                }
+
+                for (const auto &depot : depots)
+                    bb.danger_zones.insert(depot);
+            }
+            bb.enemy_index.build(bb.enemy_ships, map.width, map.height);
+            bb.danger_cargo = bb.average_halite * 3;
+            bb.threat_field.build(bb.enemy_ships, map.width, map.height, bb.params.flee_threat_radius + 1);
+            bb.enemy_tracker.update(bb.enemy_ships, bb.allied_positions, map.width, map.height);
+            bb.enemy_moves.build(bb.enemy_ships, bb.enemy_tracker, map, bb.average_halite, bb.danger_cargo);
+            bb.contention.build(bb.enemy_ships, map, bb.average_halite / hlt::constants::MOVE_COST_RATIO, bb.danger_cargo);
+
+            bb.compute_heatmap(map);
+            bb.compute_inspired_zones(map.width, map.height);
+            bb.turn_budget.start_turn();
+        }
+    } // namespace
+
+    std::unique_ptr<BenchState> make_bench_state(int map_size, int fleet, uint64_t seed)
+    {
+        sim::set_default_constants(map_size);
+        sim::Rng rng(seed);
+
+        sim::StateConfig config;
+        config.width = map_size;
+        config.height = map_size;
+        config.num_players = NUM_PLAYERS;
+        config.seed = rng.next();
+        config.progress = BENCH_PROGRESS;
+        config.ships_per_player = fleet / NUM_PLAYERS;
+
+        std::unique_ptr<BenchState> state(new BenchState());
+        state->game = sim::make_game(sim::generate_state(config), 0);
+
+        state->blackboard.reset(new bot::Blackboard());
+        fill_blackboard(*state->blackboard, *state->game);
+
+        // Ships tries par id, independamment de l'ordre de la table
+        for (const auto &ship : state->game->me->ships)
+            state->my_ships.push_back(&ship);
+        std::sort(state->my_ships.begin(), state->my_ships.end(),
+                  [](const hlt::Ship *a, const hlt::Ship *b) { return a->id < b->id; });
+
+        static const int priorities[] = {bot::constants::COLLECT_PRIORITY, bot::constants::EXPLORE_PRIORITY,
+                                         bot::constants::RETURN_PRIORITY, bot::constants::URGENT_RETURN_PRIORITY};
+
+        hlt::GameMap &map = *state->game->game_map;
+        for (const auto &ship : state->my_ships)
+        {
+            hlt::Position target = map.normalize(hlt::Position(ship->position.x + rng.uniform_int(-8, 8),
+                                                               ship->position.y + rng.uniform_int(-8, 8)));
+            state->explore_targets.push_back(target);
+
+            // Un pas vers une cell voisine, les autres directions en alternatives
+            hlt::Direction dir = hlt::ALL_CARDINALS[static_cast<size_t>(rng.uniform_int(0, 3))];
+            bot::DirectionList alternatives;
+            for (const auto &alt : hlt::ALL_CARDINALS)
+                if (alt != dir)
+                    alternatives.push_back(alt);
+
+            state->move_requests.push_back(bot::MoveRequest{
+                ship->id, ship->position, map.normalize(ship->position.directional_offset(dir)), dir,
+                priorities[rng.uniform_int(0, 3)], alternatives});
+        }
+
+        return state;
+    }
+} // namespace bench
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "hlt/game.hpp"
+#include "HaliteAI/Bot/blackboard.hpp"
+#include "HaliteAI/Bot/move_request.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace bench
+{
+    /// Etat de mi-partie synthetique, vu par le joueur 0
+    struct BenchState
+    {
+        std::unique_ptr<hlt::Game> game;
+        std::unique_ptr<bot::Blackboard> blackboard; // Non-copiable, non-deplacable
+        std::vector<const hlt::Ship *> my_ships; // Dans game->me->ships, tries par id
+        std::vector<hlt::Position> explore_targets;  // Une destination par ship de my_ships
+        bot::MoveRequests move_requests; // Une request par ship de my_ships
+    };
+
+    /// Etat sim::generate_state a mi-partie sur une map map_size x map_size a 2 joueurs,
+    /// fleet ships au total repartis entre les joueurs (moins si la map est trop pleine),
+    /// blackboard rempli comme par BotPlayer::update_blackboard. Deterministe pour une seed
+    std::unique_ptr<BenchState> make_bench_state(int map_size, int fleet, uint64_t seed);
+} // namespace bench
@@ -11,58 +11,143 @@ namespace bot
 
     bool Blackboard::is_position_safe(const hlt::Position &pos) const
     {
-        return danger_zones.find(pos) == danger_zones.end();
+        return !danger_zones.contains(pos) &&
+               enemy_moves.occupancy(pos) < params.danger_occupancy;
     }
 
     bool Blackboard::is_position_reserved(const hlt::Position &pos) const
     {
-        return reserved_positions.find(pos) != reserved_positions.end();
+        return reserved_positions.contains(pos);
     }
 
     void Blackboard::reserve_position(const hlt::Position &pos, hlt::EntityId ship_id)
     {
         reserved_positions.insert(pos);
-        targeted_cells[pos] = ship_id;
+        targeted_cells.claim(pos, ship_id, CellClaims::PERSISTENT_PRIORITY);
     }
 
     bool Blackboard::is_position_stuck(const hlt::Position &pos) const
     {
-        return stuck_positions.find(pos) != stuck_positions.end();
+        return stuck_positions.contains(pos);
+    }
+
+    void Blackboard::resize_turn_layers(int width, int height)
+    {
+        targeted_cells.resize(width, height);
+        reserved_positions.resize(width, height);
+        danger_zones.resize(width, height);
+        stuck_positions.resize(width, height);
+        inspired_zones.resize(width, height);
     }
 
     void Blackboard::clear_turn_data()
     {
         reserved_positions.clear();
-        targeted_cells.clear();
+        targeted_cells.new_turn();
         danger_zones.clear();
         stuck_positions.clear();
         enemy_ships.clear();
         inspired_zones.clear();
-        oscillating_ships.clear();
         drop_positions.clear();
         should_spawn = false;
     }
 
+    // INTENTS
+
+    bool Blackboard::intent_conflicts(const ShipIntent &intent) const
+    {
+        if (!intent.has_claimed_cell)
+            return false;
+
+        return targeted_cells.owner(intent.claimed_cell) != intent.ship_id;
+    }
+
+    void Blackboard::apply_intent(const ShipIntent &intent)
+    {
+        uint32_t slot = ship_slots.slot_of(intent.ship_id);
+        bool has_slot = slot != ShipSlots::NO_SLOT;
+
+        if (has_slot && intent.drop_persistent_target)
+            persistent_targets[slot] = hlt::Position(-1, -1);
+
+        if (has_slot && intent.has_persistent_target)
+            persistent_targets[slot] = intent.persistent_target;
+
+        if (intent.has_claimed_cell)
+            targeted_cells.claim(intent.claimed_cell, intent.ship_id, intent.claim_priority);
+
+        if (has_slot && intent.drop_hunt_target)
+            hunt_targets[slot] = -1;
+
+        if (has_slot && intent.hunt_target >= 0)
+            hunt_targets[slot] = intent.hunt_target;
+    }
+
+    // ETAT PAR SHIP
+
+    uint32_t Blackboard::register_ship(hlt::EntityId ship_id, bool &created)
+    {
+        uint32_t slot = ship_slots.acquire(ship_id, created);
+        if (!created)
+            return slot;
+
+        // Colonnes a la capacite de la slot map : ne grandissent qu'avec la flotte max
+        if (persistent_targets.size() < ship_slots.capacity())
+        {
+            persistent_targets.resize(ship_slots.capacity());
+            hunt_targets.resize(ship_slots.capacity());
+            position_history.resize(ship_slots.capacity());
+        }
+
+        persistent_targets[slot] = hlt::Position(-1, -1);
+        hunt_targets[slot] = -1;
+        position_history.reset(slot);
+        return slot;
+    }
+
+    void Blackboard::release_ship(hlt::EntityId ship_id)
+    {
+        ship_slots.release(ship_id);
+    }
+
+    void Blackboard::set_persistent_target(hlt::EntityId ship_id, const hlt::Position &target)
+    {
+        uint32_t slot = ship_slots.slot_of(ship_id);
+        if (slot != ShipSlots::NO_SLOT)
+            persistent_targets[slot] = target;
+    }
+
+    void Blackboard::clear_persistent_target(hlt::EntityId ship_id)
+    {
+        set_persistent_target(ship_id, hlt::Position(-1, -1));
+    }
+
     // Heatmap par blur exponentiel separable
     void Blackboard::compute_heatmap(const hlt::GameMap &game_map)
     {
+        BOT_STAGE_TIMER(profiler, Stage::HEATMAP);
+
         int w = game_map.width;
         int h = game_map.height;
         double alpha = 0.4;
 
-        std::vector<std::vector<double>> temp(h, std::vector<double>(w, 0.0));
-        halite_heatmap.assign(h, std::vector<int>(w, 0));
+        size_t cells = static_cast<size_t>(w) * h;
+        heatmap_rows.assign(cells, 0.0);
+        heatmap_blur.assign(cells, 0.0);
+        halite_heatmap.resize(cells);
 
         // Pass horizontal avec wrap-around
         for (int y = 0; y < h; ++y)
         {
+            double *row = &heatmap_rows[static_cast<size_t>(y) * w];
+
             // gauche à droite
             double acc = 0.0;
             for (int x = 0; x < w * 2; ++x)
             {
                 int rx = x % w;
                 acc = acc * (1.0 - alpha) + game_map.cells[y][rx].halite * alpha;
-                temp[y][rx] += acc;
+                row[rx] += acc;
             }
 
             // droite à gauche
@@ -71,37 +156,35 @@ namespace bot
             {
                 int rx = x % w;
                 acc = acc * (1.0 - alpha) + game_map.cells[y][rx].halite * alpha;
-                temp[y][rx] += acc;
+                row[rx] += acc;
             }
         }
 
         // Pass vertical avec wrap-around
-        std::vector<std::vector<double>> result(h, std::vector<double>(w, 0.0));
         for (int x = 0; x < w; ++x)
         {
             // haut à bas
             double acc = 0.0;
             for (int y = 0; y < h * 2; ++y)
             {
-                int ry = y % h;
-                acc = acc * (1.0 - alpha) + temp[ry][x] * alpha;
-                result[ry][x] += acc;
+                size_t cell = static_cast<size_t>(y % h) * w + x;
+                acc = acc * (1.0 - alpha) + heatmap_rows[cell] * alpha;
+                heatmap_blur[cell] += acc;
             }
 
             // bas à haut
             acc = 0.0;
             for (int y = h * 2 - 1; y >= 0; --y)
             {
-                int ry = y % h;
-                acc = acc * (1.0 - alpha) + temp[ry][x] * alpha;
-                result[ry][x] += acc;
+                size_t cell = static_cast<size_t>(y % h) * w + x;
+                acc = acc * (1.0 - alpha) + heatmap_rows[cell] * alpha;
+                heatmap_blur[cell] += acc;
             }
         }
 
         // Normalisation et conversion en int
-        for (int y = 0; y < h; ++y)
-            for (int x = 0; x < w; ++x)
-                halite_heatmap[y][x] = static_cast<int>(result[y][x]);
+        for (size_t cell = 0; cell < cells; ++cell)
+            halite_heatmap[cell] = static_cast<int>(heatmap_blur[cell]);
     }
 
     // Simule l'extraction tour par tour, arrete si marginal < avg/8
@@ -155,7 +238,7 @@ namespace bot
         int h = game_map.height;
 
         int cell_halite = game_map.cells[candidate.y][candidate.x].halite;
-        bool inspired = inspired_zones.find(candidate) != inspired_zones.end();
+        bool inspired = inspired_zones.contains(candidate);
         MiningEstimate est = estimate_mining(cell_halite, ship_cargo, inspired);
 
         int return_dist = dist;
@@ -181,17 +264,21 @@ namespace bot
         int score = (net_halite * 100) / total_time;
 
         // Tiebreaker heatmap pour les zones denses
-        score += halite_heatmap[candidate.y][candidate.x] / 100;
+        score += halite_heatmap[static_cast<size_t>(candidate.y) * w + candidate.x] / 100;
+
+        // Un enemy y sera avant nous : la cell sera deja entamee
+        if (contention.arrival(candidate) < dist)
+            score = score * (100 - params.contention_discount) / 100;
 
         if (recent_dropoff_pos.x < 0 || recent_dropoff_age < 0)
             return score; // Pas de boost si pas de dropoff recent
 
         int rd_dist = map_utils::toroidal_distance(candidate, recent_dropoff_pos, w, h);
-        if (rd_dist > constants::DROPOFF_REDIRECT_RADIUS)
+        if (rd_dist > params.dropoff_redirect_radius)
             return score; // Pas de boost si trop loin
 
-        int proximity_bonus = (constants::DROPOFF_REDIRECT_RADIUS - rd_dist + 1);
-        return score * (constants::DROPOFF_REDIRECT_BOOST + proximity_bonus) / constants::DROPOFF_REDIRECT_BOOST;
+        int proximity_bonus = (params.dropoff_redirect_radius - rd_dist + 1);
+        return score * (params.dropoff_redirect_boost + proximity_bonus) / params.dropoff_redirect_boost;
     }
 
     // Score HPT = halite_net / (travel + mine + return)
@@ -199,7 +286,8 @@ namespace bot
                                                        const hlt::Position &ship_pos,
                                                        hlt::EntityId ship_id,
                                                        int ship_cargo,
-                                                       const std::vector<hlt::Position> &drop_positions) const
+                                                       const std::vector<hlt::Position> &drop_positions,
+                                                       int &out_score) const
     {
         int w = game_map.width;
         int h = game_map.height;
@@ -208,31 +296,44 @@ namespace bot
         int move_cost_ratio = hlt::constants::MOVE_COST_RATIO > 0 ? hlt::constants::MOVE_COST_RATIO : 10;
         int avg_move_burn = average_halite / move_cost_ratio;
 
-        for (int dy = -constants::EXPLORE_SEARCH_RADIUS; dy <= constants::EXPLORE_SEARCH_RADIUS; ++dy)
+        int best_dy = 0;
+        int best_dx = 0;
+        bool found = false; // Pas de departage contre ship_pos : -1 = cell non rentable
+
+        // Anneaux de distance croissante : au budget epuise, le meilleur des anneaux deja vus.
+        // Egalite departagee par (dy, dx) : meme resultat qu'un balayage ligne par ligne complet
+        for (int dist = 1; dist <= explore_radius; ++dist)
         {
-            for (int dx = -constants::EXPLORE_SEARCH_RADIUS; dx <= constants::EXPLORE_SEARCH_RADIUS; ++dx)
-            {
-                int dist = std::abs(dx) + std::abs(dy);
-                if (dist > constants::EXPLORE_SEARCH_RADIUS || dist == 0)
-                    continue;
+            if (dist > 1 && !turn_budget.has_time(constants::EXPLORE_BUDGET_FRACTION))
+                break;
 
-                int nx = ((ship_pos.x + dx) % w + w) % w;
-                int ny = ((ship_pos.y + dy) % h + h) % h;
-                hlt::Position candidate(nx, ny);
+            for (int dy = -dist; dy <= dist; ++dy)
+            {
+                int rem = dist - std::abs(dy);
+                for (int dx = -rem; dx <= rem; dx += (rem > 0 ? 2 * rem : 1))
+                {
+                    int nx = ((ship_pos.x + dx) % w + w) % w;
+                    int ny = ((ship_pos.y + dy) % h + h) % h;
+                    hlt::Position candidate(nx, ny);
 
-                auto it = targeted_cells.find(candidate);
-                if (it != targeted_cells.end() && it->second != ship_id)
-                    continue;
+                    if (targeted_cells.is_claimed_by_other(candidate, ship_id, claim_visibility))
+                        continue;
 
-                int effective_score = score_explore_candidate(game_map, candidate, dist, ship_cargo, avg_move_burn, drop_positions);
-                if (effective_score > best_score)
-                {
-                    best_score = effective_score;
-                    best_pos = candidate;
+                    int effective_score = score_explore_candidate(game_map, candidate, dist, ship_cargo, avg_move_burn, drop_positions);
+                    if (effective_score > best_score ||
+                        (found && effective_score == best_score && (dy < best_dy || (dy == best_dy && dx < best_dx))))
+                    {
+                        found = true;
+                        best_score = effective_score;
+                        best_pos = candidate;
+                        best_dy = dy;
+                        best_dx = dx;
+                    }
                 }
             }
         }
 
+        out_score = best_score;
         return best_pos;
     }
 
@@ -261,35 +362,45 @@ namespace bot
         hlt::Position best_pos(-1, -1);
         int dropoff_radius = 7;
 
-        for (int y = 0; y < h; ++y)
+        // Grille de pas 4, puis 2, puis 1 : chaque passe ne voit que les cells nouvelles.
+        // Au budget epuise, le meilleur des cells deja vues.
+        // Egalite departagee par l'index ligne par ligne : meme resultat qu'un balayage complet
+        for (int step = 4; step >= 1; step /= 2)
         {
-            for (int x = 0; x < w; ++x)
+            for (int y = 0; y < h; y += step)
             {
-                hlt::Position candidate(x, y);
+                if (!turn_budget.has_time(constants::DROPOFF_BUDGET_FRACTION) && best_pos.x >= 0)
+                    return best_pos;
 
-                if (is_too_close_to_depots(candidate, existing_depots, min_depot_distance, w, h))
-                    continue;
+                for (int x = 0; x < w; x += step)
+                {
+                    // Deja vue a la passe precedente
+                    if (step < 4 && x % (2 * step) == 0 && y % (2 * step) == 0)
+                        continue;
 
-                int real_halite = map_utils::sum_halite_in_radius(game_map, candidate, dropoff_radius);
+                    hlt::Position candidate(x, y);
 
-                // Dominance : allies vs ennemis
-                std::vector<hlt::Position> enemy_pos;
-                enemy_pos.reserve(enemy_ships.size());
-                for (const auto &e : enemy_ships)
-                    enemy_pos.push_back(e.position);
+                    if (is_too_close_to_depots(candidate, existing_depots, min_depot_distance, w, h))
+                        continue;
 
-                int allies_nearby = map_utils::count_in_radius(candidate, allied_positions, dropoff_radius, w, h);
-                int enemies_nearby = map_utils::count_in_radius(candidate, enemy_pos, dropoff_radius, w, h);
+                    int real_halite = map_utils::sum_halite_in_radius(game_map, candidate, dropoff_radius);
 
-                // Zone dominee par ennemis, skip
-                if (enemies_nearby > allies_nearby + 1)
-                    continue;
+                    // Dominance : allies vs ennemis
+                    int allies_nearby = map_utils::count_in_radius(candidate, allied_positions, dropoff_radius, w, h);
+                    int enemies_nearby = enemy_index.count_within(candidate, dropoff_radius,
+                                                                  [](const EnemyShipInfo &) { return true; });
 
-                int score = real_halite + allies_nearby * 500;
-                if (score > best_score)
-                {
-                    best_score = score;
-                    best_pos = candidate;
+                    // Zone dominee par ennemis, skip
+                    if (enemies_nearby > allies_nearby + 1)
+                        continue;
+
+                    int score = real_halite + allies_nearby * 500;
+                    if (score > best_score ||
+                        (score == best_score && (y < best_pos.y || (y == best_pos.y && x < best_pos.x))))
+                    {
+                        best_score = score;
+                        best_pos = candidate;
+                    }
                 }
             }
         }
@@ -299,32 +410,24 @@ namespace bot
 
     // ANTI-OSCILLATION
 
-    void Blackboard::update_position_history(hlt::EntityId ship_id, const hlt::Position &pos)
+    void Blackboard::update_position_history(hlt::EntityId ship_id, const hlt::Position &pos,
+                                             int map_width, int map_height)
     {
-        auto &history = position_history[ship_id];
-        history.push_back(pos);
-        if (history.size() > 4)
-            history.pop_front();
-
-        // Detecte oscillation A -> B -> A -> B
-        if (history.size() == 4)
-        {
-            if (history[0] == history[2] && history[1] == history[3] && !(history[0] == history[1]))
-            {
-                oscillating_ships.insert(ship_id);
-            }
-        }
-    }
+        uint32_t slot = ship_slots.slot_of(ship_id);
+        if (slot == ShipSlots::NO_SLOT)
+            return;
 
-    bool Blackboard::is_ship_oscillating(hlt::EntityId ship_id) const
-    {
-        return oscillating_ships.find(ship_id) != oscillating_ships.end();
+        const hlt::Position &target = persistent_targets[slot];
+        int target_distance = target.x < 0 ? 0 : map_utils::toroidal_distance(pos, target, map_width, map_height);
+        position_history.record(slot, pos, target, target_distance);
     }
 
     // INSPIRATION
 
     void Blackboard::compute_inspired_zones(int map_width, int map_height)
     {
+        BOT_STAGE_TIMER(profiler, Stage::INSPIRATION);
+
         if (!hlt::constants::INSPIRATION_ENABLED)
             return;
 
@@ -337,118 +440,99 @@ namespace bot
             for (int x = 0; x < map_width; ++x)
             {
                 hlt::Position pos(x, y);
-                int count = 0;
-                for (const auto &enemy : enemy_ships)
-                {
-                    int dist = map_utils::toroidal_distance(pos, enemy.position, map_width, map_height);
-                    if (dist > radius)
-                        continue;
-
-                    ++count;
-
-                    if (count < needed)
-                        continue;
-
+                int count = enemy_index.count_within(pos, radius, [](const EnemyShipInfo &) { return true; }, needed);
+                if (count >= needed)
                     inspired_zones.insert(pos);
-                    break;
-                }
             }
         }
     }
 
     // COMBAT
 
+    // Cell visee pour chasser target : la suivante sur son trajet s'il rentre et n'est pas au contact
+    static hlt::Position hunt_aim(const EnemyTracker &tracker, const EnemyShipInfo &target,
+                                  const hlt::Position &ship_pos, int w, int h)
+    {
+        const EnemyTrack *track = tracker.find(target.id);
+        if (track == nullptr || track->behavior != EnemyBehavior::RETURNING || !track->has_last_move())
+            return target.position;
+
+        if (map_utils::toroidal_distance(ship_pos, target.position, w, h) <= 1)
+            return target.position;
+
+        return hlt::Position(((target.position.x + track->last_dx) % w + w) % w,
+                             ((target.position.y + track->last_dy) % h + h) % h);
+    }
+
     hlt::Position Blackboard::find_hunt_target(const hlt::GameMap &game_map,
                                                const hlt::Position &ship_pos,
-                                               hlt::EntityId ship_id)
+                                               hlt::EntityId ship_id,
+                                               ShipIntent &intent) const
     {
-        int w = halite_heatmap[0].size();
-        int h = halite_heatmap.size();
         int search_radius = (current_phase == GamePhase::LATE)
-                                ? constants::HUNT_RADIUS_LATE
-                                : constants::HUNT_RADIUS;
+                                ? params.hunt_radius_late
+                                : params.hunt_radius;
+
+        // L'index ne visite pas dans l'ordre de enemy_ships : egalites departagees par l'index
 
         // Target actuel encore valide ?
-        auto ht_it = hunt_targets.find(ship_id);
-        if (ht_it != hunt_targets.end())
+        hlt::EntityId current_target = hunt_target(ship_id);
+        if (current_target >= 0)
         {
-            for (const auto &enemy : enemy_ships)
-            {
-                if (enemy.id != ht_it->second &&
-                    enemy.halite < constants::HUNT_MIN_ENEMY_HALITE / 2)
-                    continue;
-
-                int dist = map_utils::toroidal_distance(ship_pos, enemy.position, w, h);
-                if (dist <= search_radius * 2)
-                    return enemy.position;
-            }
-
-            hunt_targets.erase(ht_it);
+            size_t first_valid = enemy_ships.size();
+            enemy_index.for_each_within(ship_pos, search_radius * 2,
+                                        [&](const EnemyShipInfo &enemy, size_t index, int)
+                                        {
+                                            if (enemy.id != current_target &&
+                                                enemy.halite < params.hunt_min_enemy_halite / 2)
+                                                return;
+                                            first_valid = std::min(first_valid, index);
+                                        });
+
+            if (first_valid < enemy_ships.size())
+                return hunt_aim(enemy_tracker, enemy_ships[first_valid], ship_pos, game_map.width, game_map.height);
+
+            intent.drop_hunt_target = true;
         }
 
         // Nouvelle target de chasse
         int best_score = -1;
-        hlt::Position best_pos(-1, -1);
-        hlt::EntityId best_enemy_id = -1;
-
-        for (const auto &enemy : enemy_ships)
-        {
-            if (enemy.halite < constants::HUNT_MIN_ENEMY_HALITE)
-                continue;
-
-            int dist = map_utils::toroidal_distance(ship_pos, enemy.position, w, h);
-            if (dist > search_radius || dist == 0)
-                continue;
-
-            // Defenders autour de la target
-            int defender_count = 0;
-            for (const auto &other : enemy_ships)
-            {
-                if (other.id == enemy.id)
-                    continue;
-
-                if (other.halite >= constants::DEFENDER_MAX_HALITE)
-                    continue;
-
-                int d = map_utils::toroidal_distance(other.position, enemy.position, w, h);
-                if (d <= constants::HUNT_DEFENDER_RADIUS)
-                    ++defender_count;
-            }
-
-            int score = enemy.halite - dist * 100 - defender_count * 300;
-            if (score > best_score)
-            {
-                best_score = score;
-                best_pos = enemy.position;
-                best_enemy_id = enemy.id;
-            }
-        }
-
-        if (best_enemy_id >= 0)
-            hunt_targets[ship_id] = best_enemy_id;
-
-        return best_pos;
+        size_t best_index = enemy_ships.size();
+
+        enemy_index.for_each_within(ship_pos, search_radius, [&](const EnemyShipInfo &enemy, size_t index, int dist)
+                                    {
+                                        if (enemy.halite < params.hunt_min_enemy_halite || dist == 0)
+                                            return;
+
+                                        // Defenders autour de la target
+                                        int defender_count = enemy_index.count_within(
+                                            enemy.position, params.hunt_defender_radius,
+                                            [&](const EnemyShipInfo &other)
+                                            { return other.id != enemy.id && other.halite < params.defender_max_halite; });
+
+                                        int score = enemy.halite - dist * 100 - defender_count * 300;
+                                        bool found = best_index < enemy_ships.size();
+                                        if (score > best_score || (found && score == best_score && index < best_index))
+                                        {
+                                            best_score = score;
+                                            best_index = index;
+                                        }
+                                    });
+
+        if (best_index == enemy_ships.size())
+            return hlt::Position(-1, -1);
+
+        intent.hunt_target = enemy_ships[best_index].id;
+        return hunt_aim(enemy_tracker, enemy_ships[best_index], ship_pos, game_map.width, game_map.height);
     }
 
     bool Blackboard::has_nearby_threat(const hlt::GameMap &game_map,
                                        const hlt::Position &ship_pos,
                                        int ship_halite) const
     {
-        if (ship_halite < constants::FLEE_MIN_CARGO)
+        if (ship_halite < params.flee_min_cargo)
             return false;
 
-        int w = static_cast<int>(halite_heatmap[0].size());
-        int h = static_cast<int>(halite_heatmap.size());
-
-        for (const auto &enemy : enemy_ships)
-        {
-            if (enemy.halite >= ship_halite)
-                continue;
-            int dist = map_utils::toroidal_distance(ship_pos, enemy.position, w, h);
-            if (dist <= constants::FLEE_THREAT_RADIUS)
-                return true;
-        }
-
-        return false;
+        return threat_field.min_cargo_within(ship_pos, params.flee_threat_radius) < ship_halite;
     }
 } // namespace bot
\ No newline at end of file
@@ -1,10 +1,20 @@
 #pragma once
 
 #include "bot_constants.hpp"
+#include "bot_params.hpp"
+#include "turn_budget.hpp"
+#include "stage_timer.hpp"
+#include "ship_intent.hpp"
+#include "cell_claims.hpp"
+#include "cell_set.hpp"
+#include "enemy_index.hpp"
+#include "threat_field.hpp"
+#include "enemy_tracker.hpp"
+#include "enemy_moves.hpp"
+#include "enemy_targets.hpp"
+#include "position_history.hpp"
+#include "ship_slots.hpp"
 #include "hlt/types.hpp"
-#include <set>
-#include <map>
-#include <deque>
 #include <vector>
 #include "hlt/position.hpp"
 
@@ -24,13 +34,6 @@ namespace bot
         ENDGAME // 85-100% des tours
     };
 
-    struct EnemyShipInfo
-    {
-        hlt::EntityId id;
-        hlt::Position position;
-        int halite;
-    };
-
     /// Resultat simulation extraction sur une cell
     struct MiningEstimate
     {
@@ -40,47 +43,99 @@ namespace bot
 
     struct Blackboard
     {
-
-        // Création du Singleton
-        static Blackboard &get_instance()
+        // Un Blackboard par bot, possede par BotPlayer
+        Blackboard() : current_phase(), average_halite(0), total_ships_alive(0), should_spawn(false)
         {
-            static Blackboard instance;
-            return instance;
         }
         Blackboard(Blackboard const &) = delete;
         Blackboard(Blackboard &&) = delete;
 
-    private:
-        // Constructeur privé
-        Blackboard() : current_phase(), average_halite(0), total_ships_alive(0), should_spawn(false)
+        /// Parametres de reglage, fixes pour toute la partie
+        BotParams params;
+
+        /// Budget de temps du tour courant
+        TurnBudget turn_budget;
+
+        /// Chronometres des etapes (possede par BotPlayer)
+        StageProfiler *profiler = nullptr;
+
+        /// Rayon d'explore du tour, ajuste selon le budget (params.explore_search_radius par defaut)
+        int explore_radius = constants::EXPLORE_SEARCH_RADIUS;
+
+        CellSet reserved_positions;  // Cells occupées en ce moment
+        CellClaims targeted_cells;   // Cells "destination" d'un ship
+
+        /// Priorite min d'une claim pour qu'une cell soit ignoree par l'explore.
+        /// PERSISTENT_PRIORITY pendant la phase parallele (claims du tour invisibles), 0 au merge
+        uint32_t claim_visibility = 0;
+
+        CellSet danger_zones;    // Cells des ships et structures ennemis
+        CellSet stuck_positions; // Cells occupées par des ships physiquement stuck
+
+        // ETAT PAR SHIP
+
+        /// Slot dense de chaque ship vivant, index des colonnes par ship
+        ShipSlots ship_slots;
+
+        /// Target persistant par slot, (-1, -1) si aucun
+        std::vector<hlt::Position> persistent_targets;
+
+        /// Cible de chasse par slot : enemy id, -1 si aucune
+        std::vector<hlt::EntityId> hunt_targets;
+
+        /// Dernieres positions par slot, cycles et stalls
+        PositionHistory position_history;
+
+        /// Slot du ship, attribue s'il n'en a pas encore. Colonnes agrandies et remises a zero
+        /// pour un nouveau slot, created a true dans ce cas
+        uint32_t register_ship(hlt::EntityId ship_id, bool &created);
+
+        /// Libere le slot d'un ship mort
+        void release_ship(hlt::EntityId ship_id);
+
+        /// Target persistant du ship, nullptr s'il n'en a pas
+        const hlt::Position *find_persistent_target(hlt::EntityId ship_id) const
         {
+            uint32_t slot = ship_slots.slot_of(ship_id);
+            if (slot == ShipSlots::NO_SLOT || persistent_targets[slot].x < 0)
+                return nullptr;
+            return &persistent_targets[slot];
         }
 
-    public:
-        std::set<hlt::Position> reserved_positions;            // Cells occupées en ce moment
-        std::map<hlt::Position, hlt::EntityId> targeted_cells; // Cells "destination" d'un ship
+        /// Ignore si le ship n'a pas de slot
+        void set_persistent_target(hlt::EntityId ship_id, const hlt::Position &target);
+        void clear_persistent_target(hlt::EntityId ship_id);
 
-        std::set<hlt::Position> danger_zones;    // Cells de position dangereuse
-        std::set<hlt::Position> stuck_positions; // Cells occupées par des ships physiquement stuck
+        /// Cible de chasse du ship, -1 si aucune
+        hlt::EntityId hunt_target(hlt::EntityId ship_id) const
+        {
+            uint32_t slot = ship_slots.slot_of(ship_id);
+            return slot == ShipSlots::NO_SLOT ? -1 : hunt_targets[slot];
+        }
 
         // ANTI-OSCILLATION
 
-        /// Historique des 4 dernieres positions par ship
-        std::map<hlt::EntityId, std::deque<hlt::Position>> position_history;
-
-        /// Ships en oscillation
-        std::set<hlt::EntityId> oscillating_ships;
+        /// Update historique + detecte cycles et stall vers le target persistant
+        void update_position_history(hlt::EntityId ship_id, const hlt::Position &pos, int map_width, int map_height);
 
-        /// Update historique + detecte oscillations
-        void update_position_history(hlt::EntityId ship_id, const hlt::Position &pos);
+        /// True si le ship repete un cycle de positions
+        bool is_ship_oscillating(hlt::EntityId ship_id) const
+        {
+            uint32_t slot = ship_slots.slot_of(ship_id);
+            return slot != ShipSlots::NO_SLOT && position_history.is_cycling(slot);
+        }
 
-        /// True si le ship oscille
-        bool is_ship_oscillating(hlt::EntityId ship_id) const;
+        /// True si le ship ne se rapproche plus de son target persistant
+        bool is_ship_stalled(hlt::EntityId ship_id) const
+        {
+            uint32_t slot = ship_slots.slot_of(ship_id);
+            return slot != ShipSlots::NO_SLOT && position_history.is_stalled(slot);
+        }
 
         // INSPIRATION
 
         /// Cells inspirees (>=2 ennemis dans INSPIRATION_RADIUS)
-        std::set<hlt::Position> inspired_zones;
+        CellSet inspired_zones;
 
         /// Calcule les inspired_zones a partir des ennemis
         void compute_inspired_zones(int map_width, int map_height);
@@ -90,13 +145,29 @@ namespace bot
         /// Tous les ships ennemis du tour
         std::vector<EnemyShipInfo> enemy_ships;
 
-        /// Cibles de chasse : my_ship -> enemy_id
-        std::map<hlt::EntityId, hlt::EntityId> hunt_targets;
+        /// Index spatial de enemy_ships, reconstruit avec lui chaque tour
+        EnemyIndex enemy_index;
 
-        /// Best target de chasse (-1,-1 si rien)
+        /// Historique des enemies d'un tour a l'autre et stats par adversaire
+        EnemyTracker enemy_tracker;
+
+        /// Arrivee et cargo min des enemies par cell, horizon flee_threat_radius + 1
+        ThreatField threat_field;
+
+        /// Cargo sous lequel un enemy compte dans enemy_moves (au-dessus, il evite les collisions)
+        int danger_cargo = 500;
+
+        /// Occupation predite des cells par les enemies sous danger_cargo au prochain tour
+        EnemyMoveMap enemy_moves;
+
+        /// Cells que les enemies sous danger_cargo vont probablement miner
+        ContentionMap contention;
+
+        /// Best target de chasse (-1,-1 si rien), le changement de cible va dans l'intent
         hlt::Position find_hunt_target(const hlt::GameMap &game_map,
                                        const hlt::Position &ship_pos,
-                                       hlt::EntityId ship_id);
+                                       hlt::EntityId ship_id,
+                                       ShipIntent &intent) const;
 
         /// Menace ennemi a portee de flee ?
         bool has_nearby_threat(const hlt::GameMap &game_map,
@@ -110,11 +181,20 @@ namespace bot
 
         bool should_spawn; // Faut-il spawn ce tour ?
 
-        bool is_position_safe(const hlt::Position &pos) const;                  // Cell safe ?
+        bool is_position_safe(const hlt::Position &pos) const;                  // Ni enemy ni occupation predite au prochain tour ?
         bool is_position_reserved(const hlt::Position &pos) const;              // Cell occupée ?
         void reserve_position(const hlt::Position &pos, hlt::EntityId ship_id); // Reserver une cell
+        void resize_turn_layers(int width, int height);                         // Alloue les layers du tour, une fois par partie
         void clear_turn_data();                                                 // Reset des données temporaires
 
+        // INTENTS
+
+        /// True si la cell revendiquee par l'intent est tenue par un autre ship
+        bool intent_conflicts(const ShipIntent &intent) const;
+
+        /// Applique les intentions d'un ship au blackboard
+        void apply_intent(const ShipIntent &intent);
+
         // CLUSTERING / HEATMAP
 
         // DROPOFF
@@ -134,7 +214,7 @@ namespace bot
         /// Positions allies
         std::vector<hlt::Position> allied_positions;
 
-        /// Best pos pour un nouveau dropoff
+        /// Best pos pour un nouveau dropoff, grille grossiere puis affinee tant que le budget le permet
         hlt::Position find_best_dropoff_position(
             const hlt::GameMap &game_map,
             const std::vector<hlt::Position> &existing_depots,
@@ -145,23 +225,27 @@ namespace bot
                                      const std::vector<hlt::Position> &depots,
                                      int min_distance, int w, int h) const;
 
-        std::vector<std::vector<int>> halite_heatmap;
+        /// Halite floute par cell, index y * width + x
+        std::vector<int> halite_heatmap;
 
-        /// Targets persistants
-        std::map<hlt::EntityId, hlt::Position> persistent_targets;
+        /// Passes horizontale puis verticale du flou, gardees d'un tour a l'autre
+        std::vector<double> heatmap_rows;
+        std::vector<double> heatmap_blur;
 
-        /// Calcule la heatmap
+        /// Calcule la heatmap, sans allocation une fois la taille de la map connue
         void compute_heatmap(const hlt::GameMap &game_map);
 
         /// Simule extraction tour par tour
         MiningEstimate estimate_mining(int cell_halite, int ship_cargo, bool inspired) const;
 
-        /// Best target explore via HPT = net / (aller + mine + retour)
+        /// Best target explore via HPT = net / (aller + mine + retour).
+        /// Anneaux de distance croissante jusqu'a explore_radius, arret si le budget est epuise
         hlt::Position find_best_explore_target(const hlt::GameMap &game_map,
                                                const hlt::Position &ship_pos,
                                                hlt::EntityId ship_id,
                                                int ship_cargo,
-                                               const std::vector<hlt::Position> &drop_positions) const;
+                                               const std::vector<hlt::Position> &drop_positions,
+                                               int &out_score) const;
 
         /// Score HPT d'une cell candidate pour l'exploration
         int score_explore_candidate(const hlt::GameMap &game_map,
@@ -2,6 +2,7 @@
 
 namespace bot
 {
+    /// Valeurs compilees par defaut de BotParams (bot_params.hpp), lu au runtime via le Blackboard
     namespace constants
     {
         // SHIP FSM
@@ -19,6 +20,8 @@ namespace bot
         constexpr int HEATMAP_RADIUS = 4;
         /// Rayon de recherche pour l'explore
         constexpr int EXPLORE_SEARCH_RADIUS = 10;
+        /// Rayon max si le budget le permet (= EXPLORE_SEARCH_RADIUS : pas d'extension, parties reproductibles)
+        constexpr int EXPLORE_MAX_SEARCH_RADIUS = 10;
         /// Halite min pour qu'un target reste valide
         constexpr int TARGET_MIN_HALITE = 50;
 
@@ -64,6 +67,15 @@ namespace bot
         constexpr int EXPLORE_PRIORITY = 20;
         /// Collecte
         constexpr int COLLECT_PRIORITY = 10;
+        /// Ecart max entre priorites pour le tri par comptage du trafic, au-dela tri par comparaison
+        constexpr int TRAFFIC_COUNTING_SORT_RANGE = 1024;
+
+        // MOVE REQUEST SCORES
+
+        /// Penalite d'un move vers une cell dangereuse. Scores <= : moves a eviter pour le traffic
+        constexpr int MOVE_SCORE_UNSAFE = -(1 << 24);
+        /// Penalite d'un move vers une cell stuck, cumulable avec MOVE_SCORE_UNSAFE
+        constexpr int MOVE_SCORE_STUCK = 2 * MOVE_SCORE_UNSAFE;
 
         // HUNT
 
@@ -95,5 +107,80 @@ namespace bot
         constexpr int FLEE_THREAT_RADIUS = 2;
         constexpr int FLEE_MIN_CARGO = 300;
 
+        // PREDICTION ENNEMIE
+
+        /// Occupation predite a partir de laquelle une cell est dangereuse (voisine d'un enemy sans info : 0.2)
+        constexpr float DANGER_OCCUPANCY = 0.2f;
+        /// Poids ajoute au move que l'enemy a fait au tour precedent (STILL compris)
+        constexpr float ENEMY_HEADING_WEIGHT = 3.0f;
+        /// Poids ajoute a STILL pour un enemy sur une cell riche, pas encore plein
+        constexpr float ENEMY_MINING_WEIGHT = 4.0f;
+        /// Poids ajoute aux moves qui rapprochent un enemy charge de son depot
+        constexpr float ENEMY_RETURN_WEIGHT = 4.0f;
+        /// Cargo a partir duquel un enemy est suppose rentrer, ratio du MAX_HALITE
+        constexpr float ENEMY_RETURN_CARGO_RATIO = 0.7f;
+
+        // SUIVI ENNEMI
+
+        /// Tours gardes dans l'historique de chaque ship ennemi
+        constexpr int ENEMY_TRACK_LENGTH = 8;
+        /// Cargo max d'un enemy qui s'approche de nos ships pour etre suppose en chasse
+        constexpr int ENEMY_HUNTER_MAX_CARGO = 100;
+        /// Distance a notre ship le plus proche sous laquelle l'approche d'un enemy compte comme chasse
+        constexpr int ENEMY_HUNT_DETECT_RADIUS = 3;
+        /// Part des tours-ships passes en chasse a partir de laquelle un adversaire est agressif
+        constexpr float ENEMY_AGGRESSIVE_RATIO = 0.1f;
+
+        // CIBLES ENNEMIES
+
+        /// Rayon dans lequel chaque enemy est suppose choisir sa prochaine cell de mine
+        constexpr int ENEMY_TARGET_RADIUS = 5;
+        /// Tours de mine supposes dans le score HPT simplifie des enemies
+        constexpr int ENEMY_TARGET_MINE_TURNS = 4;
+        /// Reduction en % du score d'une cell qu'un enemy vise et atteint avant nous
+        constexpr int CONTENTION_DISCOUNT = 50;
+
+        // ANTI-OSCILLATION
+
+        /// Plus long cycle de positions detecte, l'historique garde le double de tours
+        constexpr int POSITION_CYCLE_MAX_LENGTH = 4;
+        /// Tours sans se rapprocher de son target avant qu'un ship soit considere bloque
+        constexpr int POSITION_STALL_TURNS = 8;
+
+        // MEMOIRE
+
+        /// Taille initiale de l'arena du tour, agrandie au pic si un tour deborde
+        constexpr int TURN_ARENA_BYTES = 256 * 1024;
+
+        // BUDGET DE TEMPS
+
+        /// Limite officielle d'un tour
+        constexpr double TURN_TIME_LIMIT_MS = 2000.0;
+        /// Part de la limite utilisable par play_turn, le reste couvre I/O, parsing et jitter
+        constexpr double TURN_TIME_SAFETY = 0.5;
+        /// Lissage de la calibration du cout par ship
+        constexpr double TURN_TIME_SMOOTHING = 0.2;
+        /// Fractions du budget au-dela desquelles chaque etape rend son meilleur resultat,
+        /// croissantes dans l'ordre du tour pour garder du temps aux etapes suivantes
+        constexpr double DROPOFF_BUDGET_FRACTION = 0.4;
+        constexpr double EXPLORE_BUDGET_FRACTION = 0.7;
+        constexpr double TRAFFIC_BUDGET_FRACTION = 0.9;
+        /// Nombre max de passes de raffinement du trafic
+        constexpr int TRAFFIC_REFINE_PASSES = 4;
+        /// Rayon d'explore min quand le budget force a reduire la recherche
+        constexpr int EXPLORE_MIN_SEARCH_RADIUS = 3;
+
+        // INDEX SPATIAL
+
+        /// Cote des tuiles de l'index des ennemis (agrandi si la map depasse MAX_AXIS_TILES tuiles)
+        constexpr int ENEMY_INDEX_TILE_SIZE = 8;
+
+        // PARALLELISME
+
+        /// Nombre max de workers pour la phase de decision des ships
+        constexpr int MAX_DECISION_WORKERS = 7;
+        /// Nombre min de ships pour paralleliser la phase de decision
+        constexpr int PARALLEL_MIN_SHIPS = 16;
+
     } // namespace constants
 } // namespace bot
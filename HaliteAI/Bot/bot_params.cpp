@@ -0,0 +1,164 @@
+#include "bot_params.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+
+namespace bot
+{
+    namespace
+    {
+        ParamSpec int_param(const char *name, int BotParams::*field, double min_value, double max_value,
+                            bool tunable = true)
+        {
+            return ParamSpec{name, field, nullptr, min_value, max_value, tunable};
+        }
+
+        ParamSpec float_param(const char *name, float BotParams::*field, double min_value, double max_value,
+                              bool tunable = true)
+        {
+            return ParamSpec{name, nullptr, field, min_value, max_value, tunable};
+        }
+
+        std::string trim(const std::string &text)
+        {
+            size_t begin = text.find_first_not_of(" \t\r");
+            if (begin == std::string::npos)
+                return std::string();
+            size_t end = text.find_last_not_of(" \t\r");
+            return text.substr(begin, end - begin + 1);
+        }
+    } // namespace
+
+    double ParamSpec::get(const BotParams &params) const
+    {
+        return int_field ? static_cast<double>(params.*int_field) : static_cast<double>(params.*float_field);
+    }
+
+    void ParamSpec::set(BotParams &params, double value) const
+    {
+        if (int_field)
+            params.*int_field = static_cast<int>(std::lround(value));
+        else
+            params.*float_field = static_cast<float>(value);
+    }
+
+    const std::vector<ParamSpec> &param_specs()
+    {
+        static const std::vector<ParamSpec> specs = {
+            int_param("safe_return_turns", &BotParams::safe_return_turns, 5, 60),
+            float_param("halite_fill_threshold", &BotParams::halite_fill_threshold, 0.6, 1.0),
+
+            int_param("heatmap_radius", &BotParams::heatmap_radius, 2, 8),
+            int_param("explore_search_radius", &BotParams::explore_search_radius, 5, 20),
+            int_param("explore_max_search_radius", &BotParams::explore_max_search_radius, 5, 32, false), // Depend du temps
+            int_param("target_min_halite", &BotParams::target_min_halite, 10, 200),
+
+            int_param("spawn_min_turns_left", &BotParams::spawn_min_turns_left, 40, 200),
+            int_param("spawn_max_ships_base", &BotParams::spawn_max_ships_base, 10, 80),
+            int_param("spawn_min_avg_halite", &BotParams::spawn_min_avg_halite, 20, 250),
+            int_param("spawn_congestion_radius", &BotParams::spawn_congestion_radius, 1, 4),
+            int_param("spawn_congestion_limit", &BotParams::spawn_congestion_limit, 1, 8),
+
+            int_param("max_dropoffs", &BotParams::max_dropoffs, 0, 6),
+            int_param("dropoff_redirect_radius", &BotParams::dropoff_redirect_radius, 4, 20),
+            int_param("dropoff_redirect_duration", &BotParams::dropoff_redirect_duration, 0, 40),
+            int_param("dropoff_redirect_boost", &BotParams::dropoff_redirect_boost, 1, 10),
+            int_param("min_ships_for_dropoff", &BotParams::min_ships_for_dropoff, 2, 20),
+            int_param("min_dropoff_depot_distance_ratio", &BotParams::min_dropoff_depot_distance_ratio, 2, 8),
+
+            int_param("ship_on_dropoff_priority", &BotParams::ship_on_dropoff_priority, 0, 0, false),
+            int_param("urgent_return_near_priority", &BotParams::urgent_return_near_priority, 0, 0, false),
+            int_param("urgent_return_priority", &BotParams::urgent_return_priority, 0, 0, false),
+            int_param("flee_priority", &BotParams::flee_priority, 0, 0, false),
+            int_param("hunt_priority", &BotParams::hunt_priority, 0, 0, false),
+            int_param("return_priority", &BotParams::return_priority, 0, 0, false),
+            int_param("explore_priority", &BotParams::explore_priority, 0, 0, false),
+            int_param("collect_priority", &BotParams::collect_priority, 0, 0, false),
+
+            int_param("hunt_radius", &BotParams::hunt_radius, 2, 12),
+            int_param("hunt_radius_late", &BotParams::hunt_radius_late, 1, 8),
+            int_param("hunt_max_own_halite", &BotParams::hunt_max_own_halite, 0, 500),
+            int_param("hunt_min_enemy_halite", &BotParams::hunt_min_enemy_halite, 300, 1000),
+            int_param("hunt_defender_radius", &BotParams::hunt_defender_radius, 1, 4),
+            int_param("defender_max_halite", &BotParams::defender_max_halite, 0, 500),
+
+            float_param("smart_return_cargo_ratio", &BotParams::smart_return_cargo_ratio, 0.4, 0.95),
+            int_param("smart_return_max_dist", &BotParams::smart_return_max_dist, 0, 6),
+
+            int_param("flee_threat_radius", &BotParams::flee_threat_radius, 1, 4),
+            int_param("flee_min_cargo", &BotParams::flee_min_cargo, 0, 900),
+
+            float_param("danger_occupancy", &BotParams::danger_occupancy, 0.05, 0.8),
+            int_param("contention_discount", &BotParams::contention_discount, 0, 100),
+        };
+        return specs;
+    }
+
+    bool BotParams::parse(std::istream &in)
+    {
+        bool ok = true;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            size_t comment = line.find('#');
+            if (comment != std::string::npos)
+                line.erase(comment);
+            line = trim(line);
+            if (line.empty())
+                continue;
+
+            size_t eq = line.find('=');
+            if (eq == std::string::npos)
+            {
+                ok = false;
+                continue;
+            }
+
+            std::string name = trim(line.substr(0, eq));
+            std::string value = trim(line.substr(eq + 1));
+            char *end = nullptr;
+            double parsed = std::strtod(value.c_str(), &end);
+            if (value.empty() || *end != '\0')
+            {
+                ok = false;
+                continue;
+            }
+
+            bool known = false;
+            for (const auto &spec : param_specs())
+            {
+                if (name == spec.name)
+                {
+                    spec.set(*this, parsed);
+                    known = true;
+                    break;
+                }
+            }
+            ok = ok && known;
+        }
+        return ok;
+    }
+
+    bool BotParams::load(const std::string &path)
+    {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        return parse(in);
+    }
+
+    void BotParams::write(std::ostream &out) const
+    {
+        for (const auto &spec : param_specs())
+            out << spec.name << " = " << spec.get(*this) << "\n";
+    }
+
+    std::string params_file_name(int map_width, int map_height, int num_players)
+    {
+        return "params_" + std::to_string(map_width) + "x" + std::to_string(map_height) + "_" +
+               std::to_string(num_players) + "p.txt";
+    }
+} // namespace bot
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "bot_constants.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace bot
+{
+    /// Parametres de reglage du bot, chargeables au demarrage.
+    /// Les valeurs par defaut sont celles compilees dans bot_constants.hpp
+    struct BotParams
+    {
+        // SHIP FSM
+        int safe_return_turns = constants::SAFE_RETURN_TURNS;
+        float halite_fill_threshold = constants::HALITE_FILL_THRESHOLD;
+
+        // HEATMAP / EXPLORE
+        int heatmap_radius = constants::HEATMAP_RADIUS;
+        int explore_search_radius = constants::EXPLORE_SEARCH_RADIUS;
+        int explore_max_search_radius = constants::EXPLORE_MAX_SEARCH_RADIUS;
+        int target_min_halite = constants::TARGET_MIN_HALITE;
+
+        // SPAWN
+        int spawn_min_turns_left = constants::SPAWN_MIN_TURNS_LEFT;
+        int spawn_max_ships_base = constants::SPAWN_MAX_SHIPS_BASE;
+        int spawn_min_avg_halite = constants::SPAWN_MIN_AVG_HALITE;
+        int spawn_congestion_radius = constants::SPAWN_CONGESTION_RADIUS;
+        int spawn_congestion_limit = constants::SPAWN_CONGESTION_LIMIT;
+
+        // DROPOFF
+        int max_dropoffs = constants::MAX_DROPOFFS;
+        int dropoff_redirect_radius = constants::DROPOFF_REDIRECT_RADIUS;
+        int dropoff_redirect_duration = constants::DROPOFF_REDIRECT_DURATION;
+        int dropoff_redirect_boost = constants::DROPOFF_REDIRECT_BOOST;
+        int min_ships_for_dropoff = constants::MIN_SHIPS_FOR_DROPOFF;
+        int min_dropoff_depot_distance_ratio = constants::MIN_DROPOFF_DEPOT_DISTANCE_RATIO;
+
+        // MOVE REQUEST PRIORITY LEVELS
+        int ship_on_dropoff_priority = constants::SHIP_ON_DROPOFF_PRIORITY;
+        int urgent_return_near_priority = constants::URGENT_RETURN_NEAR_PRIORITY;
+        int urgent_return_priority = constants::URGENT_RETURN_PRIORITY;
+        int flee_priority = constants::FLEE_PRIORITY;
+        int hunt_priority = constants::HUNT_PRIORITY;
+        int return_priority = constants::RETURN_PRIORITY;
+        int explore_priority = constants::EXPLORE_PRIORITY;
+        int collect_priority = constants::COLLECT_PRIORITY;
+
+        // HUNT
+        int hunt_radius = constants::HUNT_RADIUS;
+        int hunt_radius_late = constants::HUNT_RADIUS_LATE;
+        int hunt_max_own_halite = constants::HUNT_MAX_OWN_HALITE;
+        int hunt_min_enemy_halite = constants::HUNT_MIN_ENEMY_HALITE;
+        int hunt_defender_radius = constants::HUNT_DEFENDER_RADIUS;
+        int defender_max_halite = constants::DEFENDER_MAX_HALITE;
+
+        // SMART RETURN
+        float smart_return_cargo_ratio = constants::SMART_RETURN_CARGO_RATIO;
+        int smart_return_max_dist = constants::SMART_RETURN_MAX_DIST;
+
+        // FLEE
+        int flee_threat_radius = constants::FLEE_THREAT_RADIUS;
+        int flee_min_cargo = constants::FLEE_MIN_CARGO;
+
+        // PREDICTION ENNEMIE
+        float danger_occupancy = constants::DANGER_OCCUPANCY;
+        int contention_discount = constants::CONTENTION_DISCOUNT;
+
+        /// Lit des lignes "nom = valeur" ('#' commente), les cles absentes gardent leur valeur.
+        /// False si une ligne est invalide ou une cle inconnue (les autres sont appliquees)
+        bool parse(std::istream &in);
+
+        /// parse() depuis un fichier, false s'il n'existe pas
+        bool load(const std::string &path);
+
+        /// Ecrit tous les parametres, relisible par parse()
+        void write(std::ostream &out) const;
+    };
+
+    /// Description d'un parametre : nom dans les fichiers, champ et bornes pour le tuner
+    struct ParamSpec
+    {
+        const char *name;
+        int BotParams::*int_field;     // nullptr pour un float
+        float BotParams::*float_field; // nullptr pour un int
+        double min_value;
+        double max_value;
+        bool tunable;                  // Pas de reglage auto : priorites (ordre a garder), params inutilises ou lies au temps
+
+        double get(const BotParams &params) const;
+        /// Arrondi pour un int, sans clamp
+        void set(BotParams &params, double value) const;
+    };
+
+    /// Tous les parametres de BotParams, dans l'ordre de la struct
+    const std::vector<ParamSpec> &param_specs();
+
+    /// Nom du fichier de params d'un format : params_<w>x<h>_<n>p.txt
+    std::string params_file_name(int map_width, int map_height, int num_players);
+} // namespace bot
@@ -4,12 +4,18 @@
 #include "hlt/log.hpp"
 #include "hlt/constants.hpp"
 #include <algorithm>
+#include <array>
+#include <cmath>
 
 namespace bot
 {
 
-    BotPlayer::BotPlayer(hlt::Game &game_instance) : game(game_instance)
+    BotPlayer::BotPlayer(hlt::Game &game_instance, const BotParams &params, size_t decision_workers)
+        : game(game_instance), m_decision_pool(decision_workers)
     {
+        m_blackboard.params = params;
+        m_blackboard.explore_radius = params.explore_search_radius;
+        m_blackboard.profiler = &m_profiler;
     }
 
     // UPDATE BLACKBOARD
@@ -17,24 +23,28 @@ namespace bot
     // Update le blackboard avec les donnees du turn
     void BotPlayer::update_blackboard()
     {
-        Blackboard &bb = Blackboard::get_instance();
-        std::shared_ptr<hlt::Player> me = game.me;
+        BOT_STAGE_TIMER(&m_profiler, Stage::UPDATE_BLACKBOARD);
+
+        Blackboard &bb = m_blackboard;
+        const std::shared_ptr<hlt::Player> &me = game.me;
         std::unique_ptr<hlt::GameMap> &game_map = game.game_map;
 
+        bb.resize_turn_layers(game_map->width, game_map->height);
         bb.clear_turn_data();
+        register_ships(bb, *me);
         bb.total_ships_alive = static_cast<int>(me->ships.size());
-        bb.drop_positions = get_drops_positions();
+        get_drops_positions(bb.drop_positions);
 
         // Positions allies pour dominance dropoff
         bb.allied_positions.clear();
-        for (const auto &ship_pair : me->ships)
-            bb.allied_positions.push_back(ship_pair.second->position);
+        for (const auto &ship : me->ships)
+            bb.allied_positions.push_back(ship.position);
 
         // Aging du bonus post-dropoff
         if (bb.recent_dropoff_age >= 0)
         {
             bb.recent_dropoff_age++;
-            if (bb.recent_dropoff_age > constants::DROPOFF_REDIRECT_DURATION)
+            if (bb.recent_dropoff_age > bb.params.dropoff_redirect_duration)
             {
                 bb.recent_dropoff_pos = {-1, -1};
                 bb.recent_dropoff_age = -1;
@@ -45,7 +55,9 @@ namespace bot
 
         update_game_phase(bb);
 
-        update_stuck_ships(bb, game_map, me);
+        update_explore_radius(bb);
+
+        update_stuck_ships(bb, game_map, *me);
 
         // Calcul de la heatmap pour le clustering
         bb.compute_heatmap(*game_map);
@@ -57,7 +69,7 @@ namespace bot
         // Calculer les zones d'inspiration
         bb.compute_inspired_zones(game_map->width, game_map->height);
 
-        update_position_history(bb, game_map, me);
+        update_position_history(bb, game_map, *me);
     }
 
     // FONCTIONS DE BLACKBOARD
@@ -65,6 +77,7 @@ namespace bot
     // Stats de la map
     void BotPlayer::update_map_stats(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map)
     {
+        BOT_STAGE_TIMER(&m_profiler, Stage::MAP_STATS);
 
         long long total_halite = 0;
         int cell_count = game_map->width * game_map->height;
@@ -81,6 +94,33 @@ namespace bot
         bb.average_halite = (cell_count > 0) ? static_cast<int>(total_halite / cell_count) : 0;
     }
 
+    // Cout de l'explore ~ rayon^2 : reduit si le tour predit depasse sa part du budget,
+    // remonte vers params.explore_search_radius puis jusqu'a explore_max_search_radius s'il reste de la marge
+    void BotPlayer::update_explore_radius(Blackboard &bb)
+    {
+        int radius = bb.explore_radius;
+        int base_radius = bb.params.explore_search_radius;
+        int max_radius = std::max(base_radius, bb.params.explore_max_search_radius);
+
+        double allowed = constants::EXPLORE_BUDGET_FRACTION * bb.turn_budget.budget_ms();
+        double predicted = bb.turn_budget.predicted_turn_ms(bb.total_ships_alive);
+
+        if (predicted > allowed)
+        {
+            int scaled = static_cast<int>(radius * std::sqrt(allowed / predicted));
+            radius = std::max(constants::EXPLORE_MIN_SEARCH_RADIUS, std::min(radius - 1, scaled));
+        }
+        else if (radius < base_radius)
+            ++radius;
+        else if (radius < max_radius &&
+                 predicted * (radius + 1) * (radius + 1) < 0.5 * allowed * radius * radius)
+            ++radius;
+        else if (radius > max_radius)
+            radius = max_radius;
+
+        bb.explore_radius = radius;
+    }
+
     // Phase de jeu
     void BotPlayer::update_game_phase(Blackboard &bb)
     {
@@ -103,19 +143,17 @@ namespace bot
     }
 
     // Ships bloqués
-    void BotPlayer::update_stuck_ships(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, std::shared_ptr<hlt::Player> me)
+    void BotPlayer::update_stuck_ships(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, const hlt::Player &me)
     {
         // Ship stuck : pas assez de halite pour bouger hors de la cell
-        for (const auto &ship_pair : me->ships)
+        for (const auto &ship : me.ships)
         {
-            const auto &ship = ship_pair.second;
-
-            int cell_halite = game_map->at(ship->position)->halite;
+            int cell_halite = game_map->at(ship.position)->halite;
             int move_cost = cell_halite / hlt::constants::MOVE_COST_RATIO;
 
-            if (ship->halite < move_cost)
+            if (ship.halite < move_cost)
             {
-                bb.stuck_positions.insert(game_map->normalize(ship->position));
+                bb.stuck_positions.insert(game_map->normalize(ship.position));
             }
         }
     }
@@ -123,56 +161,66 @@ namespace bot
     // Infos ennemis
     void BotPlayer::update_enemy_info(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map)
     {
+        BOT_STAGE_TIMER(&m_profiler, Stage::ENEMY_INFO);
+
+        // Seuil de halite pour considérer un ennemi comme une menace mobile
+        bb.danger_cargo = bb.total_ships_alive > 0 ? (bb.average_halite * 3) : 500;
+
         for (const auto &player : game.players)
         {
             if (player->id == game.my_id)
                 continue;
 
-            for (const auto &ship_pair : player->ships)
+            std::vector<hlt::Position> &depots = m_enemy_depots;
+            depots.clear();
+            depots.push_back(game_map->normalize(player->shipyard.position));
+            for (const auto &dropoff : player->dropoffs)
+                depots.push_back(game_map->normalize(dropoff.position));
+
+            for (const auto &ship : player->ships)
             {
-                hlt::Position norm_pos = game_map->normalize(ship_pair.second->position);
+                hlt::Position norm_pos = game_map->normalize(ship.position);
+                hlt::Position depot = map_utils::closest_position(norm_pos, depots, game_map->width, game_map->height);
                 bb.danger_zones.insert(norm_pos);
-                bb.enemy_ships.push_back({ship_pair.first, norm_pos, ship_pair.second->halite});
+                bb.enemy_ships.push_back({ship.id, norm_pos, ship.halite, player->id, depot});
+            }
 
-                // Adjacents dangereux si l'ennemi est leger et mobile
-                int cell_h = game_map->at(norm_pos)->halite;
-                int move_cost = cell_h / hlt::constants::MOVE_COST_RATIO;
-                int avg_ship_halite = bb.total_ships_alive > 0 ? (bb.average_halite * 3) : 500;
+            for (const auto &depot : depots)
+                bb.danger_zones.insert(depot);
+        }
 
-                // Seuil de halite pour considérer un ennemi comme une menace mobile
-                if (ship_pair.second->halite >= move_cost && ship_pair.second->halite < avg_ship_halite)
-                {
+        bb.enemy_index.build(bb.enemy_ships, game_map->width, game_map->height);
+        bb.threat_field.build(bb.enemy_ships, game_map->width, game_map->height, bb.params.flee_threat_radius + 1);
 
-                    for (const auto &adj : norm_pos.get_surrounding_cardinals())
-                        bb.danger_zones.insert(game_map->normalize(adj));
-                }
-            }
+        bb.enemy_tracker.update(bb.enemy_ships, bb.allied_positions, game_map->width, game_map->height);
 
-            bb.danger_zones.insert(game_map->normalize(player->shipyard->position));
+        // Occupation predite des enemies legers, a la place de toutes leurs voisines
+        bb.enemy_moves.build(bb.enemy_ships, bb.enemy_tracker, *game_map, bb.average_halite, bb.danger_cargo);
 
-            for (const auto &dropoff_pair : player->dropoffs)
-            {
-                bb.danger_zones.insert(game_map->normalize(dropoff_pair.second->position));
-            }
-        }
+        // Cibles de mine probables des enemies, pour l'explore
+        int move_cost_ratio = hlt::constants::MOVE_COST_RATIO > 0 ? hlt::constants::MOVE_COST_RATIO : 10;
+        bb.contention.build(bb.enemy_ships, *game_map, bb.average_halite / move_cost_ratio, bb.danger_cargo);
     }
 
     // Marquer les persistent_targets comme targeted_cells
     void BotPlayer::update_persistent_targets(Blackboard &bb)
     {
-        for (const auto &pt : bb.persistent_targets)
+        for (uint32_t slot = 0; slot < bb.ship_slots.capacity(); ++slot)
         {
-            bb.targeted_cells[pt.second] = pt.first;
+            hlt::EntityId ship_id = bb.ship_slots.id_at(slot);
+            if (ship_id >= 0 && bb.persistent_targets[slot].x >= 0)
+                bb.targeted_cells.claim(bb.persistent_targets[slot], ship_id, CellClaims::PERSISTENT_PRIORITY);
         }
     }
 
     // Update l'historique de positions pour detecter les oscillations
-    void BotPlayer::update_position_history(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, std::shared_ptr<hlt::Player> me)
+    void BotPlayer::update_position_history(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, const hlt::Player &me)
     {
-        for (const auto &ship_pair : me->ships)
+        for (const auto &ship : me.ships)
         {
-            bb.update_position_history(ship_pair.first,
-                                       game_map->normalize(ship_pair.second->position));
+            bb.update_position_history(ship.id,
+                                       game_map->normalize(ship.position),
+                                       game_map->width, game_map->height);
         }
     }
 
@@ -180,82 +228,215 @@ namespace bot
 
     // NETTOYAGE
 
-    // Supprime les FSM des ships morts
+    // Libere les slots des ships morts : FSM, targets et historique avec
     void BotPlayer::cleanup_dead_ships()
     {
-        Blackboard &bb = Blackboard::get_instance();
+        Blackboard &bb = m_blackboard;
         const auto &alive_ships = game.me->ships;
 
-        for (auto it = ship_fsms.begin(); it != ship_fsms.end();)
+        for (uint32_t slot = 0; slot < bb.ship_slots.capacity(); ++slot)
         {
-            if (alive_ships.find(it->first) != alive_ships.end())
-            {
-                ++it;
+            hlt::EntityId ship_id = bb.ship_slots.id_at(slot);
+            if (ship_id < 0 || alive_ships.contains(ship_id))
                 continue;
-            }
 
-            bb.persistent_targets.erase(it->first);
-            bb.hunt_targets.erase(it->first);
-            bb.position_history.erase(it->first);
-            it = ship_fsms.erase(it);
+            bb.release_ship(ship_id);
+        }
+    }
+
+    // Nouveau ship : slot, colonnes du blackboard remises a zero et FSM en EXPLORE
+    void BotPlayer::register_ships(Blackboard &bb, const hlt::Player &me)
+    {
+        for (const auto &ship : me.ships)
+        {
+            bool created = false;
+            uint32_t slot = bb.register_ship(ship.id, created);
+            if (!created)
+                continue;
+
+            if (ship_fsms.size() < bb.ship_slots.capacity())
+                ship_fsms.resize(bb.ship_slots.capacity(), ShipFSM(-1));
+            ship_fsms[slot] = ShipFSM(ship.id);
         }
     }
 
     // HELPERS
 
     // Get Drops Positions
-    std::vector<hlt::Position> BotPlayer::get_drops_positions() const
+    void BotPlayer::get_drops_positions(std::vector<hlt::Position> &out) const
     {
-        std::vector<hlt::Position> positions;
-        positions.push_back(game.me->shipyard->position);
+        out.clear();
+        out.push_back(game.me->shipyard.position);
 
-        for (const auto &dropoff_pair : game.me->dropoffs)
+        for (const auto &dropoff : game.me->dropoffs)
         {
-            positions.push_back(dropoff_pair.second->position);
+            out.push_back(dropoff.position);
         }
-
-        return positions;
     }
 
     // Closest drop
     hlt::Position BotPlayer::closest_drop(const hlt::Position &pos) const
     {
-        std::vector<hlt::Position> depots = get_drops_positions();
-        return map_utils::closest_position(pos, depots, game.game_map->width, game.game_map->height);
+        return map_utils::closest_position(pos, m_blackboard.drop_positions, game.game_map->width,
+                                           game.game_map->height);
     }
 
     // MOVE REQUESTS
 
     // Collecte les MoveRequests de tous les ships via leurs FSM
-    std::vector<MoveRequest> BotPlayer::collect_move_requests()
+    MoveRequests BotPlayer::collect_move_requests()
     {
-        std::shared_ptr<hlt::Player> me = game.me;
-        std::unique_ptr<hlt::GameMap> &game_map = game.game_map;
+        BOT_STAGE_TIMER(&m_profiler, Stage::COLLECT_MOVES);
+
         int turns_remaining = hlt::constants::MAX_TURNS - game.turn_number;
 
-        std::vector<MoveRequest> requests;
-        requests.reserve(me->ships.size());
+        prepare_decisions();
+        evaluate_ship_states(turns_remaining);
 
-        for (const auto &ship_pair : me->ships)
-        {
-            std::shared_ptr<hlt::Ship> ship = ship_pair.second;
+        // Pendant la phase parallele, l'explore ne voit que les claims persistantes :
+        // les claims du tour arrivent dans un ordre non deterministe
+        m_blackboard.claim_visibility = CellClaims::PERSISTENT_PRIORITY;
+
+        // Phase de decision : le blackboard n'est pas modifie, chaque ship ecrit son intent
+        auto decide = [this, turns_remaining](size_t i)
+        { decide_ship(m_decisions[i], turns_remaining); };
 
+        run_ship_tasks(m_decisions.size(), decide);
+
+        merge_decisions(turns_remaining);
+
+        MoveRequests requests;
+        requests.reserve(m_decisions.size());
+        for (const auto &decision : m_decisions)
+            requests.push_back(decision.request);
+
+        return requests;
+    }
+
+    // Liste les ships a decider ce tour, tries par id pour un merge deterministe
+    void BotPlayer::prepare_decisions()
+    {
+        const Blackboard &bb = m_blackboard;
+
+        m_decisions.clear();
+        m_decisions.reserve(game.me->ships.size());
+
+        for (const auto &ship : game.me->ships)
+        {
             // Skip si ship en cours de conversion en dropoff
-            if (should_skip_ship(*ship))
+            if (should_skip_ship(ship))
                 continue;
 
-            // Skip si ship est en mission de dropoff
-            const Blackboard &bb_ref = Blackboard::get_instance();
+            ShipDecision decision;
+            decision.ship = &ship;
+            decision.is_dropoff_ship = is_dropoff_ship(ship, bb);
+            decision.request = MoveRequest{};
+            decision.intent.reset(ship.id);
+            m_decisions.push_back(decision);
+        }
+
+        std::sort(m_decisions.begin(), m_decisions.end(),
+                  [](const ShipDecision &a, const ShipDecision &b)
+                  { return a.ship->id < b.ship->id; });
 
-            if (is_dropoff_ship(*ship, bb_ref))
-                // Navigation manuelle vers la pos du dropoff
-                requests.push_back(handle_dropoff_ship(ship, *game_map, bb_ref));
+        // Table des ships normaux, groupes par etat du FSM puis par id
+        std::array<size_t, SHIP_STATE_COUNT> state_counts{};
+        for (const auto &decision : m_decisions)
+            if (!decision.is_dropoff_ship)
+                ++state_counts[static_cast<size_t>(fsm_of(decision.ship->id).get_state())];
 
-            else
-                requests.push_back(handle_normal_ship(ship, *game_map, turns_remaining));
+        m_ship_table.reset(state_counts);
+
+        int width = game.game_map->width;
+        for (size_t i = 0; i < m_decisions.size(); ++i)
+        {
+            const ShipDecision &decision = m_decisions[i];
+            if (decision.is_dropoff_ship)
+                continue;
+
+            const hlt::Ship &ship = *decision.ship;
+            m_ship_table.insert(fsm_of(ship.id).get_state(), ship.id, static_cast<uint32_t>(i),
+                                ship.position.y * width + ship.position.x, ship.halite);
         }
+    }
 
-        return requests;
+    // Les features ne dependent que du blackboard : calculees en parallele, puis chaque
+    // groupe d'etat teste ses transitions en une boucle sur les colonnes de la table
+    void BotPlayer::evaluate_ship_states(int turns_remaining)
+    {
+        const Blackboard &bb = m_blackboard;
+
+        run_ship_tasks(m_ship_table.size(), [this](size_t row)
+                       {
+                           ShipDecision &decision = m_decisions[m_ship_table.decisions[row]];
+                           const hlt::Ship &ship = *decision.ship;
+
+                           decision.drop_position = closest_drop(ship.position);
+                           decision.features = compute_ship_features(ship, *game.game_map, decision.drop_position,
+                                                                     m_blackboard);
+                           m_ship_table.set_features(row, decision.features);
+                       });
+
+        ShipFSM::evaluate_transitions(m_ship_table, bb, turns_remaining);
+
+        for (size_t row = 0; row < m_ship_table.size(); ++row)
+            fsm_of(m_ship_table.ids[row]).set_state(m_ship_table.next_states[row]);
+    }
+
+    void BotPlayer::run_ship_tasks(size_t count, const std::function<void(size_t)> &task)
+    {
+        if (count >= static_cast<size_t>(constants::PARALLEL_MIN_SHIPS))
+        {
+            // Les workers allouent aussi dans l'arena du tour
+            m_decision_pool.parallel_for(count, [this, &task](size_t i)
+                                         {
+                                             TurnArena::Scope arena_scope(&m_arena);
+                                             task(i);
+                                         });
+        }
+        else
+            for (size_t i = 0; i < count; ++i)
+                task(i);
+    }
+
+    // Decision d'un ship, puis claim CAS de sa cell target
+    void BotPlayer::decide_ship(ShipDecision &decision, int turns_remaining)
+    {
+        Blackboard &bb = m_blackboard;
+
+        if (decision.is_dropoff_ship)
+            // Navigation manuelle vers la pos du dropoff
+            decision.request = handle_dropoff_ship(*decision.ship, *game.game_map, bb);
+        else
+            decision.request = handle_normal_ship(*decision.ship, *game.game_map, decision.drop_position,
+                                                  turns_remaining, bb, decision.features, decision.intent);
+
+        // Le meilleur score garde la cell quel que soit l'ordre d'execution
+        const ShipIntent &intent = decision.intent;
+        if (intent.has_claimed_cell)
+            bb.targeted_cells.claim(intent.claimed_cell, intent.ship_id, intent.claim_priority);
+    }
+
+    // Applique les intents dans l'ordre des ids. Un ship dont la claim a ete volee
+    // par un meilleur score refait son behavior sur les claims finales
+    void BotPlayer::merge_decisions(int turns_remaining)
+    {
+        Blackboard &bb = m_blackboard;
+        bb.claim_visibility = 0;
+
+        for (auto &decision : m_decisions)
+        {
+            if (bb.intent_conflicts(decision.intent))
+            {
+                const hlt::Ship &ship = *decision.ship;
+                decision.intent.reset(ship.id);
+                ShipFSM &fsm = fsm_of(ship.id);
+                decision.request = fsm.behave(ship, *game.game_map, decision.drop_position,
+                                              turns_remaining, bb, decision.features, decision.intent);
+            }
+
+            bb.apply_intent(decision.intent);
+        }
     }
 
     // FONCTIONS DE MOVE REQUESTS
@@ -276,34 +457,36 @@ namespace bot
     }
 
     // Navigation spéciale dropoff
-    MoveRequest BotPlayer::handle_dropoff_ship(std::shared_ptr<hlt::Ship> ship,
+    MoveRequest BotPlayer::handle_dropoff_ship(const hlt::Ship &ship,
                                                hlt::GameMap &map,
                                                const Blackboard &bb)
     {
         hlt::Direction best_dir;
-        std::vector<hlt::Direction> alternatives;
+        DirectionList alternatives;
 
         map_utils::navigate_toward(ship, map, bb.planned_dropoff_pos,
                                    bb.stuck_positions, bb.danger_zones,
+                                   bb.enemy_moves, bb.params.danger_occupancy,
                                    best_dir, alternatives);
 
-        hlt::Position desired = map.normalize(ship->position.directional_offset(best_dir));
+        hlt::Position desired = map.normalize(ship.position.directional_offset(best_dir));
 
-        return {ship->id, ship->position, desired, best_dir,
-                constants::RETURN_PRIORITY, alternatives};
+        return {ship.id, ship.position, desired, best_dir,
+                bb.params.return_priority, alternatives};
     }
 
     // Ship normal (FSM)
-    MoveRequest BotPlayer::handle_normal_ship(std::shared_ptr<hlt::Ship> ship,
+    MoveRequest BotPlayer::handle_normal_ship(const hlt::Ship &ship,
                                               hlt::GameMap &map,
-                                              int turns_remaining)
+                                              const hlt::Position &drop_position,
+                                              int turns_remaining,
+                                              const Blackboard &bb,
+                                              const ShipFeatures &features,
+                                              ShipIntent &intent)
     {
-        auto fsm_it = ship_fsms.find(ship->id);
-        if (fsm_it == ship_fsms.end())
-            fsm_it = ship_fsms.emplace(ship->id, std::make_unique<ShipFSM>(ship->id)).first;
-
-        hlt::Position depot = closest_drop(ship->position);
-        return fsm_it->second->update(ship, map, depot, turns_remaining);
+        // FSM creee par register_ships et evaluee par evaluate_ship_states, lookup en lecture seule
+        ShipFSM &fsm = fsm_of(ship.id);
+        return fsm.behave(ship, map, drop_position, turns_remaining, bb, features, intent);
     }
     // _____________________________________
 
@@ -312,8 +495,10 @@ namespace bot
     // Tenter de construire un dropoff si les conditions sont reunies
     bool BotPlayer::try_build_dropoff(std::vector<hlt::Command> &commands)
     {
-        Blackboard &bb = Blackboard::get_instance();
-        std::shared_ptr<hlt::Player> me = game.me;
+        BOT_STAGE_TIMER(&m_profiler, Stage::DROPOFF);
+
+        Blackboard &bb = m_blackboard;
+        const std::shared_ptr<hlt::Player> &me = game.me;
         std::unique_ptr<hlt::GameMap> &game_map = game.game_map;
 
         if (!can_build_dropoff(bb, *me, *game_map))
@@ -334,13 +519,13 @@ namespace bot
                                       const hlt::Player &me,
                                       const hlt::GameMap &map) const
     {
-        if ((int)me.dropoffs.size() >= constants::MAX_DROPOFFS)
+        if ((int)me.dropoffs.size() >= bb.params.max_dropoffs)
             return false;
 
         if (bb.current_phase == GamePhase::LATE || bb.current_phase == GamePhase::ENDGAME)
             return false;
 
-        if (bb.total_ships_alive < constants::MIN_SHIPS_FOR_DROPOFF)
+        if (bb.total_ships_alive < bb.params.min_ships_for_dropoff)
             return false;
 
         if (me.halite < hlt::constants::DROPOFF_COST / 2)
@@ -352,10 +537,11 @@ namespace bot
     // Reset si ship mort
     void BotPlayer::reset_dead_dropoff_plan(Blackboard &bb, const hlt::Player &me)
     {
-        if (bb.dropoff_ship_id < 0 || me.ships.find(bb.dropoff_ship_id) != me.ships.end())
+        if (bb.dropoff_ship_id < 0 || me.ships.contains(bb.dropoff_ship_id))
             return;
 
-        hlt::log::log("Dropoff: ship mort, reset plan");
+        if (hlt::log::enabled())
+            hlt::log::log("Dropoff: ship mort, reset plan");
         bb.planned_dropoff_pos = {-1, -1};
         bb.dropoff_ship_id = -1;
     }
@@ -372,30 +558,31 @@ namespace bot
                                          hlt::Player &me,
                                          hlt::GameMap &map)
     {
-        auto ship_it = me.ships.find(bb.dropoff_ship_id);
-        if (ship_it == me.ships.end())
+        const hlt::Ship *ship = me.ships.find(bb.dropoff_ship_id);
+        if (ship == nullptr)
             return false;
 
-        auto ship = ship_it->second;
         hlt::Position target = bb.planned_dropoff_pos;
 
         if (map.at(target)->has_structure())
         {
-            hlt::log::log("Dropoff: position bloquee par structure, reset plan");
+            if (hlt::log::enabled())
+                hlt::log::log("Dropoff: position bloquee par structure, reset plan");
             clear_dropoff_plan(bb, ship->id);
             return false;
         }
 
         if (bb.is_ship_oscillating(ship->id))
         {
-            hlt::log::log("Dropoff: ship oscille, reset plan");
+            if (hlt::log::enabled())
+                hlt::log::log("Dropoff: ship oscille, reset plan");
             clear_dropoff_plan(bb, ship->id);
             return false;
         }
 
         if (ship->position != target)
         {
-            bb.persistent_targets[ship->id] = target;
+            bb.set_persistent_target(ship->id, target);
             return false;
         }
 
@@ -407,7 +594,8 @@ namespace bot
         if (me.halite < real_cost)
             return false;
 
-        hlt::log::log("Dropoff: conversion ship " + std::to_string(ship->id));
+        if (hlt::log::enabled())
+            hlt::log::log("Dropoff: conversion ship " + std::to_string(ship->id));
         commands.push_back(ship->make_dropoff());
         m_converting_ship_id = ship->id;
 
@@ -429,44 +617,43 @@ namespace bot
                                             hlt::Player &me,
                                             hlt::GameMap &map)
     {
-        int min_depot_dist = std::max(8, map.width / constants::MIN_DROPOFF_DEPOT_DISTANCE_RATIO);
+        int min_depot_dist = std::max(8, map.width / bb.params.min_dropoff_depot_distance_ratio);
 
-        std::vector<hlt::Position> depots = get_drops_positions();
-        hlt::Position best_pos = bb.find_best_dropoff_position(map, depots, min_depot_dist);
+        hlt::Position best_pos = bb.find_best_dropoff_position(map, bb.drop_positions, min_depot_dist);
 
         if (best_pos.x < 0)
             return false;
 
-        auto best_ship = find_best_dropoff_ship(me, map, best_pos);
-        if (!best_ship)
+        const hlt::Ship *best_ship = find_best_dropoff_ship(me, map, best_pos);
+        if (best_ship == nullptr)
             return false;
 
         bb.planned_dropoff_pos = best_pos;
         bb.dropoff_ship_id = best_ship->id;
-        bb.persistent_targets[best_ship->id] = best_pos;
+        bb.set_persistent_target(best_ship->id, best_pos);
 
-        hlt::log::log("Dropoff plan created ship " + std::to_string(best_ship->id));
+        if (hlt::log::enabled())
+            hlt::log::log("Dropoff plan created ship " + std::to_string(best_ship->id));
         return false;
     }
 
     // Trouver le meilleur ship
-    std::shared_ptr<hlt::Ship> BotPlayer::find_best_dropoff_ship(hlt::Player &me,
-                                                                 hlt::GameMap &map,
-                                                                 const hlt::Position &pos)
+    const hlt::Ship *BotPlayer::find_best_dropoff_ship(const hlt::Player &me,
+                                                       hlt::GameMap &map,
+                                                       const hlt::Position &pos)
     {
-        std::shared_ptr<hlt::Ship> best_ship = nullptr;
+        const hlt::Ship *best_ship = nullptr;
         int best_dist = 9999;
         int max_assign_dist = map.width / 3;
 
-        for (const auto &p : me.ships)
+        for (const auto &ship : me.ships)
         {
-            const auto &ship = p.second;
-            int d = map.calculate_distance(ship->position, pos);
+            int d = map.calculate_distance(ship.position, pos);
 
             if (d < best_dist && d <= max_assign_dist)
             {
                 best_dist = d;
-                best_ship = ship;
+                best_ship = &ship;
             }
         }
 
@@ -476,7 +663,7 @@ namespace bot
     // Reset le plan dropoff
     void BotPlayer::clear_dropoff_plan(Blackboard &bb, hlt::EntityId ship_id)
     {
-        bb.persistent_targets.erase(ship_id);
+        bb.clear_persistent_target(ship_id);
         bb.planned_dropoff_pos = {-1, -1};
         bb.dropoff_ship_id = -1;
     }
@@ -484,43 +671,39 @@ namespace bot
     // Redirige les ships proches vers la zone du nouveau dropoff pour miner autour
     void BotPlayer::redirect_ships_to_new_dropoff(Blackboard &bb, const hlt::Position &dropoff_pos)
     {
-        std::shared_ptr<hlt::Player> me = game.me;
+        const std::shared_ptr<hlt::Player> &me = game.me;
         std::unique_ptr<hlt::GameMap> &game_map = game.game_map;
         int w = game_map->width;
         int h = game_map->height;
 
-        hlt::log::log("Redirect: checking " + std::to_string(me->ships.size()) + " ships near dropoff (" + std::to_string(dropoff_pos.x) + "," + std::to_string(dropoff_pos.y) + ")");
+        if (hlt::log::enabled())
+            hlt::log::log("Redirect: checking " + std::to_string(me->ships.size()) + " ships near dropoff (" + std::to_string(dropoff_pos.x) + "," + std::to_string(dropoff_pos.y) + ")");
 
-        for (const auto &ship_pair : me->ships)
+        for (const auto &ship : me->ships)
         {
-            const auto &ship = ship_pair.second;
             // Skip le ship qui vient d'etre converti en dropoff
-            if (ship->id == m_converting_ship_id)
+            if (ship.id == m_converting_ship_id)
                 continue;
 
             // Skip si trop loin du nouveau dropoff
-            int dist = map_utils::toroidal_distance(ship->position, dropoff_pos, w, h);
-            if (dist > constants::DROPOFF_REDIRECT_RADIUS)
+            int dist = map_utils::toroidal_distance(ship.position, dropoff_pos, w, h);
+            if (dist > bb.params.dropoff_redirect_radius)
                 continue;
 
             // Skip si le ship est deja plein, il doit return pas redirect
-            if (ship->halite >= hlt::constants::MAX_HALITE * constants::HALITE_FILL_THRESHOLD)
-                continue;
-
-            auto fsm_it = ship_fsms.find(ship->id);
-            if (fsm_it == ship_fsms.end())
+            if (ship.halite >= hlt::constants::MAX_HALITE * bb.params.halite_fill_threshold)
                 continue;
 
             // Chercher la meilleure cell autour du dropoff pour ce ship
             int best_score = -1;
             hlt::Position best_cell = dropoff_pos;
 
-            for (int dy = -constants::HEATMAP_RADIUS; dy <= constants::HEATMAP_RADIUS; ++dy)
+            for (int dy = -bb.params.heatmap_radius; dy <= bb.params.heatmap_radius; ++dy)
             {
-                for (int dx = -constants::HEATMAP_RADIUS; dx <= constants::HEATMAP_RADIUS; ++dx)
+                for (int dx = -bb.params.heatmap_radius; dx <= bb.params.heatmap_radius; ++dx)
                 {
                     int md = std::abs(dx) + std::abs(dy);
-                    if (md > constants::HEATMAP_RADIUS || md == 0)
+                    if (md > bb.params.heatmap_radius || md == 0)
                         continue;
 
                     // Cell candidate en toroidal
@@ -529,8 +712,7 @@ namespace bot
                     hlt::Position candidate(nx, ny);
 
                     // Skip si deja target par un autre ship
-                    auto it = bb.targeted_cells.find(candidate);
-                    if (it != bb.targeted_cells.end() && it->second != ship->id)
+                    if (bb.targeted_cells.is_claimed_by_other(candidate, ship.id))
                         continue;
 
                     int cell_halite = game_map->at(candidate)->halite;
@@ -543,9 +725,10 @@ namespace bot
             }
 
             // Assigner la target persistante vers la zone du dropoff
-            bb.persistent_targets[ship->id] = best_cell;
-            bb.targeted_cells[best_cell] = ship->id;
-            hlt::log::log("Redirect ship " + std::to_string(ship->id) + " to new dropoff zone");
+            bb.set_persistent_target(ship.id, best_cell);
+            bb.targeted_cells.claim(best_cell, ship.id, CellClaims::PERSISTENT_PRIORITY);
+            if (hlt::log::enabled())
+                hlt::log::log("Redirect ship " + std::to_string(ship.id) + " to new dropoff zone");
         }
     }
 
@@ -554,11 +737,11 @@ namespace bot
     // SPAWN
 
     // Conditions de spawn
-    bool BotPlayer::should_spawn(const std::vector<MoveRequest> &requests,
-                                 const std::vector<MoveResult> &results) const
+    bool BotPlayer::should_spawn(const MoveRequests &requests,
+                                 const MoveResults &results) const
     {
-        const Blackboard &bb = Blackboard::get_instance();
-        std::shared_ptr<hlt::Player> me = game.me;
+        const Blackboard &bb = m_blackboard;
+        const std::shared_ptr<hlt::Player> &me = game.me;
         std::unique_ptr<hlt::GameMap> &game_map = game.game_map;
         int turns_remaining = hlt::constants::MAX_TURNS - game.turn_number;
 
@@ -591,7 +774,7 @@ namespace bot
         if (bb.current_phase == GamePhase::LATE || bb.current_phase == GamePhase::ENDGAME)
             return false;
 
-        if (turns_remaining < constants::SPAWN_MIN_TURNS_LEFT)
+        if (turns_remaining < bb.params.spawn_min_turns_left)
             return false;
 
         return true;
@@ -613,23 +796,23 @@ namespace bot
     // Map assez riche ?
     bool BotPlayer::map_is_rich_enough(const Blackboard &bb) const
     {
-        return bb.average_halite >= constants::SPAWN_MIN_AVG_HALITE;
+        return bb.average_halite >= bb.params.spawn_min_avg_halite;
     }
 
     // Limite de ships
     bool BotPlayer::below_max_ships(const Blackboard &bb, const hlt::GameMap &map) const
     {
-        int max_ships = constants::SPAWN_MAX_SHIPS_BASE * map.width / 64;
+        int max_ships = bb.params.spawn_max_ships_base * map.width / 64;
         return bb.total_ships_alive < max_ships;
     }
 
     // Collision sur le shipyard
     bool BotPlayer::shipyard_will_be_occupied(const hlt::Player &me,
                                               std::unique_ptr<hlt::GameMap> &map,
-                                              const std::vector<MoveRequest> &requests,
-                                              const std::vector<MoveResult> &results) const
+                                              const MoveRequests &requests,
+                                              const MoveResults &results) const
     {
-        hlt::Position shipyard_pos = me.shipyard->position;
+        hlt::Position shipyard_pos = me.shipyard.position;
 
         for (const auto &res : results)
         {
@@ -658,39 +841,66 @@ namespace bot
     // Congestion autour du shipyard
     bool BotPlayer::shipyard_congested(const hlt::Player &me, const hlt::GameMap &map) const
     {
-        hlt::Position yard_pos = me.shipyard->position;
+        hlt::Position yard_pos = me.shipyard.position;
         int nearby = 0;
 
         // Compter les ships à proximité du shipyard
-        for (const auto &ship_pair : me.ships)
+        for (const auto &ship : me.ships)
         {
-            int d = map_utils::toroidal_distance(ship_pair.second->position, yard_pos, map.width, map.height);
-            if (d <= constants::SPAWN_CONGESTION_RADIUS)
+            int d = map_utils::toroidal_distance(ship.position, yard_pos, map.width, map.height);
+            if (d <= m_blackboard.params.spawn_congestion_radius)
                 ++nearby;
         }
 
-        return nearby >= constants::SPAWN_CONGESTION_LIMIT;
+        return nearby >= m_blackboard.params.spawn_congestion_limit;
     }
 
-    std::vector<hlt::Command> BotPlayer::play_turn()
+    const std::vector<hlt::Command> &BotPlayer::play_turn()
     {
+        // Plus rien ne lit les conteneurs du tour precedent : m_decisions n'est que vide ensuite
+        m_arena.reset();
+
+        {
+            TurnArena::Scope arena_scope(&m_arena);
+            BOT_STAGE_TIMER(&m_profiler, Stage::PLAY_TURN);
+            run_turn();
+        }
+
+#ifdef BOT_STAGE_TIMERS
+        // Dernier tour : histogrammes de la partie dans le log
+        if (game.turn_number >= hlt::constants::MAX_TURNS)
+            hlt::log::log("Stage timers\n" + m_profiler.report());
+#endif
+
+        return m_commands;
+    }
+
+    void BotPlayer::run_turn()
+    {
+        m_blackboard.turn_budget.start_turn();
+
         m_converting_ship_id = -1;
 
         cleanup_dead_ships();
 
         update_blackboard();
 
-        std::vector<hlt::Command> commands;
+        std::vector<hlt::Command> &commands = m_commands;
+        commands.clear();
         bool built_dropoff = try_build_dropoff(commands);
 
-        std::vector<MoveRequest> move_requests = collect_move_requests();
+        MoveRequests move_requests = collect_move_requests();
 
-        std::vector<hlt::Position> drops_positions = get_drops_positions();
         int turns_remaining = hlt::constants::MAX_TURNS - game.turn_number;
 
-        TrafficManager &traffic = TrafficManager::instance();
-        traffic.init(*game.game_map, drops_positions, game.me->ships, turns_remaining);
-        std::vector<MoveResult> move_results = traffic.resolve_all(move_requests);
+        m_traffic.init(*game.game_map, m_blackboard.drop_positions, game.me->ships, turns_remaining, m_blackboard.params,
+                       m_blackboard.turn_budget);
+        const MoveResults *traffic_results = nullptr;
+        {
+            BOT_STAGE_TIMER(&m_profiler, Stage::TRAFFIC);
+            traffic_results = &m_traffic.resolve_all(move_requests);
+        }
+        const MoveResults &move_results = *traffic_results;
 
         commands.reserve(commands.size() + move_results.size() + 1);
 
@@ -702,9 +912,9 @@ namespace bot
         // Tenter de spawn un nouveau ship si les conditions sont reunies
         if (!built_dropoff && should_spawn(move_requests, move_results))
         {
-            commands.push_back(game.me->shipyard->spawn());
+            commands.push_back(game.me->shipyard.spawn());
         }
 
-        return commands;
+        m_blackboard.turn_budget.end_turn(static_cast<int>(game.me->ships.size()));
     }
 } // namespace bot
\ No newline at end of file
@@ -4,22 +4,53 @@
 #include "hlt/game.hpp"
 #include "hlt/command.hpp"
 #include "ship_fsm.hpp"
+#include "ship_features.hpp"
+#include "ship_table.hpp"
 #include "traffic_manager.hpp"
 #include "blackboard.hpp"
+#include "bot_params.hpp"
+#include "ship_intent.hpp"
+#include "thread_pool.hpp"
+#include "turn_arena.hpp"
+#include "stage_timer.hpp"
 
+#include <functional>
 #include <vector>
 #include <memory>
-#include <unordered_map>
 
 namespace bot
 {
     class BotPlayer
     {
     private:
+        /// Decision d'un ship pour le tour : calculee en parallele, mergee ensuite
+        struct ShipDecision
+        {
+            const hlt::Ship *ship; // Dans game.me->ships, stable pendant le tour
+            bool is_dropoff_ship;
+            ShipFeatures features;        // Calculees une fois par tour, reutilisees au merge
+            hlt::Position drop_position;  // Depot le plus proche, calcule avec les features
+            MoveRequest request;
+            ShipIntent intent;
+        };
+
         hlt::Game &game;
-        std::unordered_map<hlt::EntityId, std::unique_ptr<ShipFSM>> ship_fsms;
+        std::vector<ShipFSM> ship_fsms;          // FSM par slot de m_blackboard.ship_slots
         hlt::EntityId m_converting_ship_id = -1; // Ship en cours de conversion en dropoff
 
+        Blackboard m_blackboard;                // Etat partage du bot
+        TrafficManager m_traffic;               // Resolution des collisions
+        ThreadPool m_decision_pool;             // Workers de la phase de decision
+        std::vector<ShipDecision> m_decisions;  // Decisions du tour, triees par ship id
+        ShipTable m_ship_table;                 // Ships normaux du tour, groupes par etat du FSM
+        StageProfiler m_profiler;               // Chronometres des etapes (BOT_STAGE_TIMERS)
+        TurnArena m_arena;                      // Conteneurs transitoires du tour, reset par play_turn
+        std::vector<hlt::Command> m_commands;   // Commandes du dernier tour, rendues par play_turn
+        std::vector<hlt::Position> m_enemy_depots; // Scratch de update_enemy_info
+
+        /// Corps du tour, chronometre par play_turn : remplit m_commands
+        void run_turn();
+
         /// Update le blackboard avec les donnees du turn
         void update_blackboard();
 
@@ -29,8 +60,11 @@ namespace bot
         // Update la phase de jeu
         void update_game_phase(Blackboard &bb);
 
+        // Ajuste le rayon d'explore au budget de temps predit
+        void update_explore_radius(Blackboard &bb);
+
         // Update les ships bloqués
-        void update_stuck_ships(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, std::shared_ptr<hlt::Player> me);
+        void update_stuck_ships(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, const hlt::Player &me);
 
         // Update les infos sur les ennemis
         void update_enemy_info(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map);
@@ -39,16 +73,38 @@ namespace bot
         void update_persistent_targets(Blackboard &bb);
 
         // Update l'historique de positions
-        void update_position_history(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, std::shared_ptr<hlt::Player> me);
+        void update_position_history(Blackboard &bb, std::unique_ptr<hlt::GameMap> &game_map, const hlt::Player &me);
 
         /// Supprime les FSM des ships morts
         void cleanup_dead_ships();
 
-        /// Recupere les positions de tous les points de drop
-        std::vector<hlt::Position> get_drops_positions() const;
+        /// Slot et FSM pour chaque ship vivant, avant toute lecture de l'etat par ship
+        void register_ships(Blackboard &bb, const hlt::Player &me);
+
+        /// FSM du ship, qui doit avoir un slot
+        ShipFSM &fsm_of(hlt::EntityId ship_id) { return ship_fsms[m_blackboard.ship_slots.slot_of(ship_id)]; }
+
+        /// Positions de tous les points de drop dans out, sans reallouer
+        void get_drops_positions(std::vector<hlt::Position> &out) const;
 
         /// Collecte les MoveRequests de tous les ships via leurs FSM
-        std::vector<MoveRequest> collect_move_requests();
+        MoveRequests collect_move_requests();
+
+        // Prepare les decisions du tour (FSM creees hors phase parallele)
+        void prepare_decisions();
+
+        // Features des ships normaux puis transitions du FSM evaluees par groupe d'etat
+        void evaluate_ship_states(int turns_remaining);
+
+        // Execute task(i) pour i dans [0, count) sur le pool s'il y a assez de ships.
+        // Captures de task sur deux pointeurs au plus : std::function les garde sans allouer
+        void run_ship_tasks(size_t count, const std::function<void(size_t)> &task);
+
+        // Decision d'un ship, blackboard en lecture seule
+        void decide_ship(ShipDecision &decision, int turns_remaining);
+
+        // Merge des intents dans l'ordre des ids, re-decide les ships en conflit
+        void merge_decisions(int turns_remaining);
 
         // Logique de skip de ship
         bool should_skip_ship(const hlt::Ship &ship) const;
@@ -57,16 +113,20 @@ namespace bot
         bool is_dropoff_ship(const hlt::Ship &ship, const Blackboard &bb) const;
 
         // Navigation spéciale dropoff
-        MoveRequest handle_dropoff_ship(std::shared_ptr<hlt::Ship> ship,
+        MoveRequest handle_dropoff_ship(const hlt::Ship &ship,
                                         hlt::GameMap &map,
                                         const Blackboard &bb);
 
         // Ship normal (FSM)
-        MoveRequest handle_normal_ship(std::shared_ptr<hlt::Ship> ship,
+        MoveRequest handle_normal_ship(const hlt::Ship &ship,
                                        hlt::GameMap &map,
-                                       int turns_remaining);
+                                       const hlt::Position &drop_position,
+                                       int turns_remaining,
+                                       const Blackboard &bb,
+                                       const ShipFeatures &features,
+                                       ShipIntent &intent);
 
-        /// Retourne la position du drop le plus proche de la position donnee
+        /// Retourne la position du drop le plus proche de la position donnee (drop_positions du blackboard)
         hlt::Position closest_drop(const hlt::Position &pos) const;
 
         /// Tente de construire un dropoff si les conditions sont reunies
@@ -88,7 +148,7 @@ namespace bot
         bool create_new_dropoff_plan(Blackboard &, hlt::Player &, hlt::GameMap &);
 
         // Trouver le meilleur ship
-        std::shared_ptr<hlt::Ship> find_best_dropoff_ship(hlt::Player &, hlt::GameMap &, const hlt::Position &);
+        const hlt::Ship *find_best_dropoff_ship(const hlt::Player &, hlt::GameMap &, const hlt::Position &);
 
         // Reset le plan dropoff en cours
         void clear_dropoff_plan(Blackboard &bb, hlt::EntityId ship_id);
@@ -97,8 +157,8 @@ namespace bot
         void redirect_ships_to_new_dropoff(Blackboard &bb, const hlt::Position &dropoff_pos);
 
         /// Determine si on doit spawn un nouveau ship
-        bool should_spawn(const std::vector<MoveRequest> &requests,
-                          const std::vector<MoveResult> &results) const;
+        bool should_spawn(const MoveRequests &requests,
+                          const MoveResults &results) const;
 
         // Phase + tours restants
         bool can_spawn_phase(const Blackboard &, int turns_remaining) const;
@@ -114,16 +174,21 @@ namespace bot
 
         // Collision sur le shipyard
         bool shipyard_will_be_occupied(const hlt::Player &, std::unique_ptr<hlt::GameMap> &game_map,
-                                       const std::vector<MoveRequest> &,
-                                       const std::vector<MoveResult> &) const;
+                                       const MoveRequests &,
+                                       const MoveResults &) const;
 
         // Congestion autour du shipyard
         bool shipyard_congested(const hlt::Player &, const hlt::GameMap &) const;
 
     public:
-        BotPlayer(hlt::Game &game_instance);
+        BotPlayer(hlt::Game &game_instance,
+                  const BotParams &params = BotParams(),
+                  size_t decision_workers = ThreadPool::default_worker_count());
+
+        /// Joue le tour du jeu, retourne la liste des commandes a executer (valide jusqu'au tour suivant)
+        const std::vector<hlt::Command> &play_turn();
 
-        /// Joue le tour du jeu, retourne la liste des commandes a executer
-        std::vector<hlt::Command> play_turn();
+        /// Histogrammes des etapes depuis le debut de la partie
+        const StageProfiler &profiler() const { return m_profiler; }
     };
 } // namespace bot
\ No newline at end of file
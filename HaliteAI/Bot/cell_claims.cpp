@@ -0,0 +1,82 @@
+#include "cell_claims.hpp"
+
+namespace bot
+{
+    constexpr uint32_t CellClaims::PERSISTENT_PRIORITY;
+
+    void CellClaims::resize(int width, int height)
+    {
+        if (m_cells && width == m_width && height == m_height)
+            return;
+
+        m_width = width;
+        m_height = height;
+        size_t count = static_cast<size_t>(width) * height;
+        m_cells.reset(new std::atomic<uint64_t>[count]);
+        for (size_t i = 0; i < count; ++i)
+            m_cells[i].store(0, std::memory_order_relaxed);
+        m_generation = 1;
+    }
+
+    void CellClaims::new_turn()
+    {
+        ++m_generation;
+
+        // Wrap du compteur 16 bits : remise a zero complete
+        if (m_generation > 0xFFFF)
+        {
+            size_t count = static_cast<size_t>(m_width) * m_height;
+            for (size_t i = 0; i < count; ++i)
+                m_cells[i].store(0, std::memory_order_relaxed);
+            m_generation = 1;
+        }
+    }
+
+    bool CellClaims::claim(const hlt::Position &pos, hlt::EntityId ship_id, uint32_t priority)
+    {
+        std::atomic<uint64_t> &cell = m_cells[index_of(pos)];
+        uint64_t key = make_key(ship_id, priority);
+        uint64_t desired = (m_generation << 48) | key;
+        uint64_t current = cell.load(std::memory_order_acquire);
+
+        for (;;)
+        {
+            if (is_current(current))
+            {
+                uint64_t current_key = current & KEY_MASK;
+
+                // Deja owner avec une priorite au moins egale
+                if (key_owner(current) == ship_id && current_key >= key)
+                    return true;
+
+                // Claim existante plus forte
+                if (key_owner(current) != ship_id && current_key >= key)
+                    return false;
+            }
+
+            if (cell.compare_exchange_weak(current, desired,
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+                return true;
+        }
+    }
+
+    hlt::EntityId CellClaims::owner(const hlt::Position &pos) const
+    {
+        uint64_t word = m_cells[index_of(pos)].load(std::memory_order_acquire);
+        if (!is_current(word))
+            return -1;
+
+        return key_owner(word);
+    }
+
+    bool CellClaims::is_claimed_by_other(const hlt::Position &pos, hlt::EntityId ship_id,
+                                         uint32_t min_priority) const
+    {
+        uint64_t word = m_cells[index_of(pos)].load(std::memory_order_acquire);
+        if (!is_current(word))
+            return false;
+
+        return key_owner(word) != ship_id && key_priority(word) >= min_priority;
+    }
+} // namespace bot
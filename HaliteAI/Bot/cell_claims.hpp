@@ -0,0 +1,81 @@
+#pragma once
+
+#include "hlt/types.hpp"
+#include "hlt/position.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace bot
+{
+    /// Revendication des cells "destination" par les ships, sans lock.
+    /// Une cell = un mot atomique [generation 16 bits | priorite 24 bits | ship 24 bits].
+    /// Une claim d'une generation passee est consideree comme libre, new_turn() est O(1).
+    class CellClaims
+    {
+    public:
+        /// Priorite des targets persistants, jamais volee
+        static constexpr uint32_t PERSISTENT_PRIORITY = 0xFFFFFF;
+
+        CellClaims() = default;
+
+        // Non-copiable
+        CellClaims(const CellClaims &) = delete;
+        CellClaims &operator=(const CellClaims &) = delete;
+
+        /// Alloue le tableau (une fois par partie, taille de la map)
+        void resize(int width, int height);
+
+        /// Invalide toutes les claims du tour precedent
+        void new_turn();
+
+        /// Revendique la cell. Vole la claim existante si la priorite est superieure
+        /// (egalite : le plus petit id gagne). Retourne true si le ship est owner apres l'appel
+        bool claim(const hlt::Position &pos, hlt::EntityId ship_id, uint32_t priority);
+
+        /// Owner de la cell ce tour, -1 si libre
+        hlt::EntityId owner(const hlt::Position &pos) const;
+
+        /// True si un autre ship tient la cell avec une priorite >= min_priority
+        bool is_claimed_by_other(const hlt::Position &pos, hlt::EntityId ship_id,
+                                 uint32_t min_priority = 0) const;
+
+    private:
+        static constexpr uint64_t ID_MASK = 0xFFFFFF;
+        static constexpr uint64_t KEY_MASK = 0xFFFFFFFFFFFFull;
+
+        // Cle de comparaison : priorite puis plus petit id
+        static uint64_t make_key(hlt::EntityId ship_id, uint32_t priority)
+        {
+            return (static_cast<uint64_t>(priority & 0xFFFFFF) << 24) | (ID_MASK - (static_cast<uint64_t>(ship_id) & ID_MASK));
+        }
+
+        static hlt::EntityId key_owner(uint64_t word)
+        {
+            return static_cast<hlt::EntityId>(ID_MASK - (word & ID_MASK));
+        }
+
+        static uint32_t key_priority(uint64_t word)
+        {
+            return static_cast<uint32_t>((word >> 24) & 0xFFFFFF);
+        }
+
+        bool is_current(uint64_t word) const
+        {
+            return (word >> 48) == m_generation;
+        }
+
+        size_t index_of(const hlt::Position &pos) const
+        {
+            int x = ((pos.x % m_width) + m_width) % m_width;
+            int y = ((pos.y % m_height) + m_height) % m_height;
+            return static_cast<size_t>(y) * m_width + x;
+        }
+
+        std::unique_ptr<std::atomic<uint64_t>[]> m_cells;
+        int m_width = 0;
+        int m_height = 0;
+        uint64_t m_generation = 1;
+    };
+} // namespace bot
@@ -0,0 +1,53 @@
+#include "cell_set.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    void CellSet::resize(int width, int height)
+    {
+        if (!m_stamps.empty() && width == m_width && height == m_height)
+            return;
+
+        m_width = width;
+        m_height = height;
+        m_stamps.assign(static_cast<size_t>(width) * height, 0);
+        m_generation = 1;
+    }
+
+    void CellSet::clear()
+    {
+        ++m_generation;
+
+        // Wrap du compteur : remise a zero complete, le stamp 0 n'est jamais courant
+        if (m_generation == 0)
+        {
+            std::fill(m_stamps.begin(), m_stamps.end(), 0);
+            m_generation = 1;
+        }
+    }
+
+    constexpr size_t CellIndexMap::NONE;
+
+    void CellIndexMap::resize(int width, int height)
+    {
+        if (!m_slots.empty() && width == m_width && height == m_height)
+            return;
+
+        m_width = width;
+        m_height = height;
+        m_slots.assign(static_cast<size_t>(width) * height, Slot{0, 0});
+        m_generation = 1;
+    }
+
+    void CellIndexMap::clear()
+    {
+        ++m_generation;
+
+        if (m_generation == 0)
+        {
+            std::fill(m_slots.begin(), m_slots.end(), Slot{0, 0});
+            m_generation = 1;
+        }
+    }
+} // namespace bot
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "hlt/position.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    /// Ensemble de cells du tour, un stamp de generation par cell : une cell est dans l'ensemble
+    /// si son stamp vaut la generation courante, clear() est O(1). Ecritures sequentielles,
+    /// lectures concurrentes possibles pendant la phase de decision
+    class CellSet
+    {
+    public:
+        /// Alloue les stamps (une fois par partie, taille de la map)
+        void resize(int width, int height);
+
+        /// Vide l'ensemble
+        void clear();
+
+        void insert(const hlt::Position &pos) { m_stamps[index_of(pos)] = m_generation; }
+
+        bool contains(const hlt::Position &pos) const
+        {
+            return !m_stamps.empty() && m_stamps[index_of(pos)] == m_generation;
+        }
+
+    private:
+        // Positions presque toujours deja normalisees : modulo seulement hors de la map
+        size_t index_of(const hlt::Position &pos) const
+        {
+            int x = pos.x;
+            int y = pos.y;
+            if (x < 0 || x >= m_width)
+                x = ((x % m_width) + m_width) % m_width;
+            if (y < 0 || y >= m_height)
+                y = ((y % m_height) + m_height) % m_height;
+            return static_cast<size_t>(y) * m_width + x;
+        }
+
+        std::vector<uint32_t> m_stamps;
+        int m_width = 0;
+        int m_height = 0;
+        uint32_t m_generation = 1;
+    };
+
+    /// Association cell -> index du tour (une request, un ship...), memes stamps de generation
+    /// que CellSet : clear() est O(1) et la memoire est gardee d'un tour a l'autre
+    class CellIndexMap
+    {
+    public:
+        /// Valeur de find pour une cell sans index
+        static constexpr size_t NONE = static_cast<size_t>(-1);
+
+        /// Alloue les slots (une fois par partie, taille de la map)
+        void resize(int width, int height);
+
+        /// Oublie toutes les associations
+        void clear();
+
+        void set(const hlt::Position &pos, size_t index)
+        {
+            Slot &slot = m_slots[index_of(pos)];
+            slot.stamp = m_generation;
+            slot.index = static_cast<uint32_t>(index);
+        }
+
+        void erase(const hlt::Position &pos) { m_slots[index_of(pos)].stamp = 0; }
+
+        /// Index associe a la cell, NONE si aucun
+        size_t find(const hlt::Position &pos) const
+        {
+            const Slot &slot = m_slots[index_of(pos)];
+            return slot.stamp == m_generation ? slot.index : NONE;
+        }
+
+        bool contains(const hlt::Position &pos) const { return find(pos) != NONE; }
+
+    private:
+        struct Slot
+        {
+            uint32_t stamp;
+            uint32_t index;
+        };
+
+        size_t index_of(const hlt::Position &pos) const
+        {
+            int x = pos.x;
+            int y = pos.y;
+            if (x < 0 || x >= m_width)
+                x = ((x % m_width) + m_width) % m_width;
+            if (y < 0 || y >= m_height)
+                y = ((y % m_height) + m_height) % m_height;
+            return static_cast<size_t>(y) * m_width + x;
+        }
+
+        std::vector<Slot> m_slots;
+        int m_width = 0;
+        int m_height = 0;
+        uint32_t m_generation = 1;
+    };
+} // namespace bot
@@ -0,0 +1,84 @@
+#include "enemy_index.hpp"
+
+namespace bot
+{
+    void EnemyIndex::build(const std::vector<EnemyShipInfo> &enemies, int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+
+        int longest = std::max(width, height);
+        m_tile_size = std::max(constants::ENEMY_INDEX_TILE_SIZE, (longest + MAX_AXIS_TILES - 1) / MAX_AXIS_TILES);
+        m_tiles_x = (width + m_tile_size - 1) / m_tile_size;
+        m_tiles_y = (height + m_tile_size - 1) / m_tile_size;
+
+        // Comptage par tuile puis placement : entries groupees, ordre d'origine dans chaque tuile
+        size_t tile_count = static_cast<size_t>(m_tiles_x) * m_tiles_y;
+        m_tile_offsets.assign(tile_count + 1, 0);
+
+        auto tile_of = [this](const hlt::Position &pos)
+        { return static_cast<size_t>(pos.y / m_tile_size) * m_tiles_x + pos.x / m_tile_size; };
+
+        for (const auto &enemy : enemies)
+            ++m_tile_offsets[tile_of(enemy.position) + 1];
+
+        for (size_t t = 0; t < tile_count; ++t)
+            m_tile_offsets[t + 1] += m_tile_offsets[t];
+
+        m_entries.resize(enemies.size());
+        m_ids.resize(enemies.size());
+
+        for (size_t i = 0; i < enemies.size(); ++i)
+        {
+            // Les offsets servent de curseurs, decales d'une tuile puis remis en place
+            uint32_t &cursor = m_tile_offsets[tile_of(enemies[i].position)];
+            m_entries[cursor++] = {enemies[i], static_cast<uint32_t>(i)};
+            m_ids[i] = {enemies[i].id, static_cast<uint32_t>(i)};
+        }
+
+        for (size_t t = tile_count; t > 0; --t)
+            m_tile_offsets[t] = m_tile_offsets[t - 1];
+        m_tile_offsets[0] = 0;
+
+        std::sort(m_ids.begin(), m_ids.end());
+    }
+
+    int EnemyIndex::find(hlt::EntityId id) const
+    {
+        auto it = std::lower_bound(m_ids.begin(), m_ids.end(), std::make_pair(id, static_cast<uint32_t>(0)));
+        if (it == m_ids.end() || it->first != id)
+            return -1;
+        return static_cast<int>(it->second);
+    }
+
+    int EnemyIndex::axis_tiles(int center, int radius, int size, int tile_count, int *out) const
+    {
+        int span = 2 * radius + 1;
+        if (span >= size)
+        {
+            for (int t = 0; t < tile_count; ++t)
+                out[t] = t;
+            return tile_count;
+        }
+
+        // Marche de tuile en tuile depuis le bord gauche de l'intervalle, avec wrap
+        int count = 0;
+        int covered = 0;
+        int x = ((center - radius) % size + size) % size;
+        while (covered < span)
+        {
+            int tile = x / m_tile_size;
+            out[count++] = tile;
+
+            int tile_end = std::min(size, (tile + 1) * m_tile_size);
+            covered += tile_end - x;
+            x = tile_end % size;
+        }
+
+        // L'intervalle peut finir dans sa tuile de depart
+        if (count > 1 && out[count - 1] == out[0])
+            --count;
+
+        return count;
+    }
+} // namespace bot
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "bot_constants.hpp"
+#include "map_utils.hpp"
+#include "hlt/position.hpp"
+#include "hlt/types.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bot
+{
+    struct EnemyShipInfo
+    {
+        hlt::EntityId id;
+        hlt::Position position;
+        int halite;
+        hlt::PlayerId owner;
+        hlt::Position depot; // Depot de l'owner le plus proche
+    };
+
+    /// Enemy renvoye par EnemyIndex::nearest_k
+    struct EnemyNeighbor
+    {
+        size_t index; // Index dans le vecteur passe a build
+        int distance;
+    };
+
+    /// Index spatial des ships ennemis du tour : un bucket par tuile de la map torique.
+    /// Une requete de rayon ne parcourt que les tuiles qui couvrent le carre englobant,
+    /// l'ordre de visite n'est pas celui du vecteur d'origine (departager par l'index)
+    class EnemyIndex
+    {
+    public:
+        /// Tuiles max par axe, borne les tableaux de la pile des requetes
+        static constexpr int MAX_AXIS_TILES = 32;
+
+        /// Reconstruit l'index, sans reallocation une fois la capacite atteinte
+        void build(const std::vector<EnemyShipInfo> &enemies, int width, int height);
+
+        size_t size() const { return m_entries.size(); }
+
+        /// Index de l'enemy id dans le vecteur de build, -1 s'il n'existe pas
+        int find(hlt::EntityId id) const;
+
+        /// visit(enemy, index, dist) pour chaque enemy a distance <= radius de center
+        template <typename Visit>
+        void for_each_within(const hlt::Position &center, int radius, Visit &&visit) const
+        {
+            if (m_entries.empty() || radius < 0)
+                return;
+
+            int tiles_x[MAX_AXIS_TILES + 1];
+            int tiles_y[MAX_AXIS_TILES + 1];
+            int count_x = axis_tiles(center.x, radius, m_width, m_tiles_x, tiles_x);
+            int count_y = axis_tiles(center.y, radius, m_height, m_tiles_y, tiles_y);
+
+            for (int iy = 0; iy < count_y; ++iy)
+            {
+                for (int ix = 0; ix < count_x; ++ix)
+                {
+                    size_t tile = static_cast<size_t>(tiles_y[iy]) * m_tiles_x + tiles_x[ix];
+                    for (uint32_t e = m_tile_offsets[tile]; e < m_tile_offsets[tile + 1]; ++e)
+                    {
+                        const Entry &entry = m_entries[e];
+                        int dist = map_utils::toroidal_distance(center, entry.enemy.position, m_width, m_height);
+                        if (dist <= radius)
+                            visit(entry.enemy, static_cast<size_t>(entry.index), dist);
+                    }
+                }
+            }
+        }
+
+        /// Nombre d'enemies dans le rayon qui passent le filtre, compte arrete a limit
+        template <typename Filter>
+        int count_within(const hlt::Position &center, int radius, Filter &&filter, int limit = INT_MAX) const
+        {
+            int count = 0;
+            for_each_within(center, radius, [&](const EnemyShipInfo &enemy, size_t, int)
+                            {
+                                if (count < limit && filter(enemy))
+                                    ++count;
+                            });
+            return count;
+        }
+
+        /// Vrai si au moins un enemy du rayon passe le filtre
+        template <typename Filter>
+        bool any_within(const hlt::Position &center, int radius, Filter &&filter) const
+        {
+            return count_within(center, radius, filter, 1) > 0;
+        }
+
+        /// Distance du plus proche enemy du rayon qui passe le filtre, INT_MAX si aucun
+        template <typename Filter>
+        int nearest_distance(const hlt::Position &center, int radius, Filter &&filter) const
+        {
+            int best = INT_MAX;
+            for_each_within(center, radius, [&](const EnemyShipInfo &enemy, size_t, int dist)
+                            {
+                                if (dist < best && filter(enemy))
+                                    best = dist;
+                            });
+            return best;
+        }
+
+        /// Les k plus proches du rayon qui passent le filtre, tries par distance puis index
+        template <typename Filter>
+        void nearest_k(const hlt::Position &center, int radius, size_t k, Filter &&filter,
+                       std::vector<EnemyNeighbor> &out) const
+        {
+            out.clear();
+            for_each_within(center, radius, [&](const EnemyShipInfo &enemy, size_t index, int dist)
+                            {
+                                if (filter(enemy))
+                                    out.push_back({index, dist});
+                            });
+
+            auto closer = [](const EnemyNeighbor &a, const EnemyNeighbor &b)
+            { return a.distance != b.distance ? a.distance < b.distance : a.index < b.index; };
+
+            if (out.size() > k)
+            {
+                std::partial_sort(out.begin(), out.begin() + k, out.end(), closer);
+                out.resize(k);
+            }
+            else
+            {
+                std::sort(out.begin(), out.end(), closer);
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            EnemyShipInfo enemy;
+            uint32_t index;
+        };
+
+        /// Tuiles d'un axe couvertes par [center - radius, center + radius], sans doublon.
+        /// out doit avoir MAX_AXIS_TILES + 1 places
+        int axis_tiles(int center, int radius, int size, int tile_count, int *out) const;
+
+        int m_width = 0;
+        int m_height = 0;
+        int m_tile_size = constants::ENEMY_INDEX_TILE_SIZE;
+        int m_tiles_x = 0;
+        int m_tiles_y = 0;
+
+        std::vector<uint32_t> m_tile_offsets;                  // Entries de la tuile t : [offsets[t], offsets[t + 1])
+        std::vector<Entry> m_entries;                          // Groupees par tuile, ordre d'origine dans la tuile
+        std::vector<std::pair<hlt::EntityId, uint32_t>> m_ids; // Id -> index, trie par id
+    };
+} // namespace bot
@@ -0,0 +1,105 @@
+#include "enemy_moves.hpp"
+#include "bot_constants.hpp"
+#include "map_utils.hpp"
+#include "hlt/constants.hpp"
+#include "hlt/direction.hpp"
+#include "hlt/game_map.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    namespace
+    {
+        hlt::Position wrap(const hlt::Position &pos, int width, int height)
+        {
+            return hlt::Position(((pos.x % width) + width) % width, ((pos.y % height) + height) % height);
+        }
+    } // namespace
+
+    EnemyMoveOdds EnemyMoveMap::predict(const EnemyShipInfo &enemy, const EnemyTrack *track,
+                                        const hlt::GameMap &game_map, int mining_halite)
+    {
+        int w = game_map.width;
+        int h = game_map.height;
+        hlt::Position pos = wrap(enemy.position, w, h);
+        int cell_halite = game_map.cells[pos.y][pos.x].halite;
+
+        // Pas de quoi payer le move : reste sur place
+        if (enemy.halite < cell_halite / hlt::constants::MOVE_COST_RATIO)
+            return EnemyMoveOdds{{1.f, 0.f, 0.f, 0.f, 0.f}};
+
+        EnemyMoveOdds odds = {{1.f, 1.f, 1.f, 1.f, 1.f}};
+
+        // Un enemy garde en general son move du tour precedent
+        if (track != nullptr && track->has_last_move())
+        {
+            if (track->last_dx == 0 && track->last_dy == 0)
+                odds[0] += constants::ENEMY_HEADING_WEIGHT;
+
+            for (size_t i = 0; i < hlt::ALL_CARDINALS.size(); ++i)
+            {
+                hlt::Position offset = hlt::Position(0, 0).directional_offset(hlt::ALL_CARDINALS[i]);
+                if (offset.x == track->last_dx && offset.y == track->last_dy)
+                    odds[i + 1] += constants::ENEMY_HEADING_WEIGHT;
+            }
+        }
+
+        // Charge : vers son depot. Sinon reste sur une cell riche ou qu'il mine deja
+        bool returning = track != nullptr
+                             ? track->behavior == EnemyBehavior::RETURNING
+                             : enemy.halite >= constants::ENEMY_RETURN_CARGO_RATIO * hlt::constants::MAX_HALITE;
+        bool mining = cell_halite >= mining_halite ||
+                      (track != nullptr && track->behavior == EnemyBehavior::MINING);
+        if (returning)
+        {
+            int depot_distance = map_utils::toroidal_distance(pos, enemy.depot, w, h);
+            for (size_t i = 0; i < hlt::ALL_CARDINALS.size(); ++i)
+            {
+                hlt::Position next = wrap(pos.directional_offset(hlt::ALL_CARDINALS[i]), w, h);
+                if (map_utils::toroidal_distance(next, enemy.depot, w, h) < depot_distance)
+                    odds[i + 1] += constants::ENEMY_RETURN_WEIGHT;
+            }
+        }
+        else if (mining)
+        {
+            odds[0] += constants::ENEMY_MINING_WEIGHT;
+        }
+
+        float total = 0.f;
+        for (float odd : odds)
+            total += odd;
+        for (float &odd : odds)
+            odd /= total;
+
+        return odds;
+    }
+
+    void EnemyMoveMap::build(const std::vector<EnemyShipInfo> &enemies,
+                             const EnemyTracker &tracker,
+                             const hlt::GameMap &game_map, int mining_halite, int max_cargo)
+    {
+        m_width = game_map.width;
+        m_height = game_map.height;
+        m_occupancy.assign(static_cast<size_t>(m_width) * m_height, 0.f);
+
+        for (const auto &enemy : enemies)
+        {
+            if (enemy.halite >= max_cargo)
+                continue;
+
+            EnemyMoveOdds odds = predict(enemy, tracker.find(enemy.id), game_map, mining_halite);
+
+            hlt::Position pos = wrap(enemy.position, m_width, m_height);
+            for (size_t i = 0; i < odds.size(); ++i)
+            {
+                if (odds[i] <= 0.f)
+                    continue;
+
+                hlt::Position cell = i == 0 ? pos : wrap(pos.directional_offset(hlt::ALL_CARDINALS[i - 1]), m_width, m_height);
+                float &occupancy = m_occupancy[static_cast<size_t>(cell.y) * m_width + cell.x];
+                occupancy = std::min(1.f, occupancy + odds[i]);
+            }
+        }
+    }
+} // namespace bot
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "enemy_index.hpp"
+#include "enemy_tracker.hpp"
+#include "hlt/position.hpp"
+#include "hlt/types.hpp"
+
+#include <array>
+#include <vector>
+
+namespace hlt
+{
+    struct GameMap;
+}
+
+namespace bot
+{
+    /// Distribution du prochain move d'un enemy : STILL puis hlt::ALL_CARDINALS
+    using EnemyMoveOdds = std::array<float, 5>;
+
+    /// Occupation predite des cells au prochain tour. Chaque enemy sous max_cargo repartit
+    /// une probabilite de 1 sur sa cell et ses 4 voisines selon son dernier move et son
+    /// comportement (EnemyTracker), et la cell qu'il mine. Cout constant par enemy
+    class EnemyMoveMap
+    {
+    public:
+        /// tracker doit avoir ete mis a jour avec enemies
+        void build(const std::vector<EnemyShipInfo> &enemies, const EnemyTracker &tracker,
+                   const hlt::GameMap &game_map, int mining_halite, int max_cargo);
+
+        /// Somme des probabilites de presence d'un enemy sur la cell au prochain tour, bornee a 1
+        float occupancy(const hlt::Position &pos) const
+        {
+            if (m_occupancy.empty())
+                return 0.f;
+            int x = ((pos.x % m_width) + m_width) % m_width;
+            int y = ((pos.y % m_height) + m_height) % m_height;
+            return m_occupancy[static_cast<size_t>(y) * m_width + x];
+        }
+
+        /// Distribution du prochain move de l'enemy, track nullptr s'il n'a pas d'historique
+        static EnemyMoveOdds predict(const EnemyShipInfo &enemy, const EnemyTrack *track,
+                                     const hlt::GameMap &game_map, int mining_halite);
+
+    private:
+        int m_width = 0;
+        int m_height = 0;
+        std::vector<float> m_occupancy;
+    };
+} // namespace bot
@@ -0,0 +1,90 @@
+#include "enemy_targets.hpp"
+#include "bot_constants.hpp"
+#include "map_utils.hpp"
+#include "hlt/constants.hpp"
+#include "hlt/game_map.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace bot
+{
+    constexpr int ContentionMap::NO_CONTENDER;
+
+    void ContentionMap::build(const std::vector<EnemyShipInfo> &enemies, const hlt::GameMap &game_map,
+                              int avg_move_burn, int max_cargo)
+    {
+        m_width = game_map.width;
+        m_height = game_map.height;
+        size_t cells = static_cast<size_t>(m_width) * m_height;
+
+        // Offsets du losange, par distance croissante : a score egal, la cell la plus proche
+        if (m_offsets.empty())
+        {
+            int radius = constants::ENEMY_TARGET_RADIUS;
+            for (int distance = 0; distance <= radius; ++distance)
+            {
+                for (int dy = -distance; dy <= distance; ++dy)
+                {
+                    int rem = distance - std::abs(dy);
+                    for (int dx = -rem; dx <= rem; dx += (rem > 0 ? 2 * rem : 1))
+                        m_offsets.push_back({dx, dy, distance});
+                }
+            }
+        }
+
+        m_halite.resize(cells);
+        for (int y = 0; y < m_height; ++y)
+            for (int x = 0; x < m_width; ++x)
+                m_halite[static_cast<size_t>(y) * m_width + x] = game_map.cells[y][x].halite;
+
+        m_arrival.assign(cells, NO_CONTENDER);
+        m_contenders.assign(cells, 0);
+        m_targets.assign(enemies.size(), hlt::Position(-1, -1));
+
+        for (size_t i = 0; i < enemies.size(); ++i)
+        {
+            const EnemyShipInfo &enemy = enemies[i];
+            if (enemy.halite >= max_cargo)
+                continue;
+
+            int capacity = hlt::constants::MAX_HALITE - enemy.halite;
+            int ex = ((enemy.position.x % m_width) + m_width) % m_width;
+            int ey = ((enemy.position.y % m_height) + m_height) % m_height;
+
+            // HPT simplifie : halite de la cell borne au cargo libre, temps de mine fixe
+            int best_score = 0;
+            size_t best_cell = cells;
+            int best_distance = 0;
+            for (const Offset &offset : m_offsets)
+            {
+                int x = ex + offset.dx;
+                int y = ey + offset.dy;
+                x = x < 0 ? x + m_width : (x >= m_width ? x - m_width : x);
+                y = y < 0 ? y + m_height : (y >= m_height ? y - m_height : y);
+                size_t cell = static_cast<size_t>(y) * m_width + x;
+
+                int return_dist = map_utils::toroidal_distance(hlt::Position(x, y), enemy.depot, m_width, m_height);
+                int net_halite = std::min(m_halite[cell], capacity) - (offset.distance + return_dist) * avg_move_burn;
+                if (net_halite <= 0)
+                    continue;
+
+                int score = (net_halite * 100) / (offset.distance + constants::ENEMY_TARGET_MINE_TURNS + return_dist);
+                if (score > best_score)
+                {
+                    best_score = score;
+                    best_cell = cell;
+                    best_distance = offset.distance;
+                }
+            }
+
+            if (best_cell == cells)
+                continue;
+
+            m_targets[i] = hlt::Position(static_cast<int>(best_cell % m_width), static_cast<int>(best_cell / m_width));
+            m_arrival[best_cell] = std::min(m_arrival[best_cell], best_distance);
+            if (m_contenders[best_cell] < UINT16_MAX)
+                ++m_contenders[best_cell];
+        }
+    }
+} // namespace bot
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "enemy_index.hpp"
+#include "hlt/position.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hlt
+{
+    struct GameMap;
+}
+
+namespace bot
+{
+    /// Cells que les enemies vont probablement miner. Chaque enemy qui ne rentre pas choisit,
+    /// par une version simplifiee de notre score HPT, la meilleure cell de son voisinage de rayon
+    /// ENEMY_TARGET_RADIUS. Le halite est copie une fois dans une grille plate et les offsets
+    /// du losange sont precalcules : cout par enemy constant, sans allocation une fois la capacite atteinte
+    class ContentionMap
+    {
+    public:
+        /// Cell visee par aucun enemy
+        static constexpr int NO_CONTENDER = INT_MAX;
+
+        /// Reconstruit la carte. Les enemies de cargo >= max_cargo sont supposes rentrer
+        void build(const std::vector<EnemyShipInfo> &enemies, const hlt::GameMap &game_map,
+                   int avg_move_burn, int max_cargo);
+
+        /// Distance du plus proche enemy qui vise la cell, NO_CONTENDER si aucun
+        int arrival(const hlt::Position &pos) const
+        {
+            if (m_arrival.empty())
+                return NO_CONTENDER;
+            return m_arrival[index_of(pos)];
+        }
+
+        /// Nombre d'enemies qui visent la cell
+        int contenders(const hlt::Position &pos) const
+        {
+            if (m_contenders.empty())
+                return 0;
+            return m_contenders[index_of(pos)];
+        }
+
+        /// Cell visee par enemies[i] du dernier build, (-1, -1) s'il rentre
+        const hlt::Position &target(size_t i) const { return m_targets[i]; }
+
+    private:
+        struct Offset
+        {
+            int dx;
+            int dy;
+            int distance;
+        };
+
+        size_t index_of(const hlt::Position &pos) const
+        {
+            int x = ((pos.x % m_width) + m_width) % m_width;
+            int y = ((pos.y % m_height) + m_height) % m_height;
+            return static_cast<size_t>(y) * m_width + x;
+        }
+
+        int m_width = 0;
+        int m_height = 0;
+
+        std::vector<Offset> m_offsets; // Losange de rayon ENEMY_TARGET_RADIUS, par distance croissante
+        std::vector<int> m_halite;     // Halite par cell, copie du tour
+        std::vector<int> m_arrival;
+        std::vector<uint16_t> m_contenders;
+        std::vector<hlt::Position> m_targets;
+    };
+} // namespace bot
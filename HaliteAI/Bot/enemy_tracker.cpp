@@ -0,0 +1,161 @@
+#include "enemy_tracker.hpp"
+#include "hlt/constants.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace bot
+{
+    constexpr int EnemyTrack::LENGTH;
+
+    namespace
+    {
+        /// Ecart le plus court sur un axe torique
+        int wrap_delta(int delta, int size)
+        {
+            if (delta > size / 2)
+                return delta - size;
+            if (delta < -size / 2)
+                return delta + size;
+            return delta;
+        }
+    } // namespace
+
+    void EnemyTracker::update(const std::vector<EnemyShipInfo> &enemies, const std::vector<hlt::Position> &allies,
+                              int width, int height)
+    {
+        m_width = width;
+        m_height = height;
+        ++m_generation;
+
+        m_allies.resize(width, height);
+        m_allies.clear();
+        for (const auto &ally : allies)
+            m_allies.insert(ally);
+
+        m_next_live.clear();
+        for (const auto &enemy : enemies)
+        {
+            if (enemy.id < 0 || enemy.owner < 0)
+                continue;
+
+            size_t id = static_cast<size_t>(enemy.id);
+            if (id >= m_slot_of_id.size())
+                m_slot_of_id.resize(std::max(id + 1, m_slot_of_id.size() * 2), -1);
+
+            // Nouveau ship : slot recycle ou ajoute
+            int32_t &slot = m_slot_of_id[id];
+            if (slot < 0)
+            {
+                if (!m_free_slots.empty())
+                {
+                    slot = static_cast<int32_t>(m_free_slots.back());
+                    m_free_slots.pop_back();
+                }
+                else
+                {
+                    slot = static_cast<int32_t>(m_tracks.size());
+                    m_tracks.emplace_back();
+
+                    // Listes de slots a la taille des tracks : elles ne grandissent qu'avec la flotte max
+                    m_free_slots.reserve(m_tracks.capacity());
+                    m_live.reserve(m_tracks.capacity());
+                    m_next_live.reserve(m_tracks.capacity());
+                }
+
+                m_tracks[slot] = EnemyTrack();
+                m_tracks[slot].id = enemy.id;
+                m_tracks[slot].owner = enemy.owner;
+            }
+
+            EnemyTrack &track = m_tracks[slot];
+            track.m_seen = m_generation;
+            record(track, enemy);
+            m_next_live.push_back(static_cast<uint32_t>(slot));
+
+            size_t owner = static_cast<size_t>(enemy.owner);
+            if (owner >= m_opponents.size())
+                m_opponents.resize(owner + 1);
+            ++m_opponents[owner].ship_turns;
+            if (track.behavior == EnemyBehavior::HUNTING)
+                ++m_opponents[owner].hunting_turns;
+        }
+
+        // Ships disparus : slot libere
+        for (uint32_t slot : m_live)
+        {
+            const EnemyTrack &track = m_tracks[slot];
+            if (track.m_seen == m_generation)
+                continue;
+            m_slot_of_id[track.id] = -1;
+            m_free_slots.push_back(slot);
+        }
+        m_live.swap(m_next_live);
+    }
+
+    void EnemyTracker::record(EnemyTrack &track, const EnemyShipInfo &enemy)
+    {
+        int previous_ally_distance = track.ally_distance;
+
+        if (track.count > 0)
+            track.head = (track.head + 1) % EnemyTrack::LENGTH;
+        track.positions[track.head] = enemy.position;
+        track.cargo[track.head] = enemy.halite;
+        track.count = std::min(track.count + 1, EnemyTrack::LENGTH);
+
+        track.ally_distance = nearest_ally_distance(enemy.position);
+
+        // Dernier move et vitesse moyenne sur l'historique
+        track.last_dx = 0;
+        track.last_dy = 0;
+        int sum_x = 0;
+        int sum_y = 0;
+        for (int age = 0; age + 1 < track.count; ++age)
+        {
+            int dx = wrap_delta(track.position(age).x - track.position(age + 1).x, m_width);
+            int dy = wrap_delta(track.position(age).y - track.position(age + 1).y, m_height);
+            if (age == 0)
+            {
+                track.last_dx = dx;
+                track.last_dy = dy;
+            }
+            sum_x += dx;
+            sum_y += dy;
+        }
+
+        int steps = track.count - 1;
+        track.velocity_x = steps > 0 ? static_cast<float>(sum_x) / steps : 0.f;
+        track.velocity_y = steps > 0 ? static_cast<float>(sum_y) / steps : 0.f;
+
+        // Comportement
+        bool moved = track.last_dx != 0 || track.last_dy != 0;
+        if (enemy.halite >= constants::ENEMY_RETURN_CARGO_RATIO * hlt::constants::MAX_HALITE)
+            track.behavior = EnemyBehavior::RETURNING;
+        else if (track.has_last_move() && !moved && enemy.halite > track.cargo_at(1))
+            track.behavior = EnemyBehavior::MINING;
+        else if (track.has_last_move() && moved && enemy.halite <= constants::ENEMY_HUNTER_MAX_CARGO &&
+                 track.ally_distance <= constants::ENEMY_HUNT_DETECT_RADIUS &&
+                 track.ally_distance < previous_ally_distance)
+            track.behavior = EnemyBehavior::HUNTING;
+        else
+            track.behavior = EnemyBehavior::UNKNOWN;
+    }
+
+    int EnemyTracker::nearest_ally_distance(const hlt::Position &pos) const
+    {
+        // Un anneau plus proche par le wrap aurait deja ete visite : le premier trouve est le min
+        for (int dist = 0; dist <= constants::ENEMY_HUNT_DETECT_RADIUS; ++dist)
+        {
+            for (int dy = -dist; dy <= dist; ++dy)
+            {
+                int rem = dist - std::abs(dy);
+                for (int dx = -rem; dx <= rem; dx += (rem > 0 ? 2 * rem : 1))
+                {
+                    if (m_allies.contains(hlt::Position(pos.x + dx, pos.y + dy)))
+                        return dist;
+                }
+            }
+        }
+        return INT_MAX;
+    }
+} // namespace bot
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "bot_constants.hpp"
+#include "cell_set.hpp"
+#include "enemy_index.hpp"
+#include "hlt/position.hpp"
+#include "hlt/types.hpp"
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    /// Comportement deduit de l'historique d'un ship ennemi
+    enum class EnemyBehavior : uint8_t
+    {
+        UNKNOWN,   // Pas assez d'historique, ou deplacement sans motif reconnu
+        MINING,    // Immobile et cargo en hausse
+        RETURNING, // Charge, en route vers un depot
+        HUNTING    // Leger et en approche d'un de nos ships
+    };
+
+    /// Historique d'un ship ennemi : buffers circulaires des derniers tours, le plus recent a head
+    struct EnemyTrack
+    {
+        static constexpr int LENGTH = constants::ENEMY_TRACK_LENGTH;
+
+        hlt::EntityId id = -1;
+        hlt::PlayerId owner = -1;
+        int count = 0; // Tours enregistres, <= LENGTH
+        int head = 0;
+        std::array<hlt::Position, LENGTH> positions;
+        std::array<int, LENGTH> cargo;
+
+        float velocity_x = 0.f; // Deplacement moyen par tour sur l'historique
+        float velocity_y = 0.f;
+        int last_dx = 0; // Dernier move, 0 si immobile ou inconnu
+        int last_dy = 0;
+        int ally_distance = INT_MAX; // Distance a notre ship le plus proche, INT_MAX au-dela de ENEMY_HUNT_DETECT_RADIUS
+        EnemyBehavior behavior = EnemyBehavior::UNKNOWN;
+
+        /// Position il y a age tours (age < count)
+        const hlt::Position &position(int age = 0) const { return positions[(head + LENGTH - age) % LENGTH]; }
+
+        /// Cargo il y a age tours (age < count)
+        int cargo_at(int age = 0) const { return cargo[(head + LENGTH - age) % LENGTH]; }
+
+        /// Le move du tour precedent est connu
+        bool has_last_move() const { return count >= 2; }
+
+    private:
+        friend class EnemyTracker;
+        uint32_t m_seen = 0; // Generation du dernier update ou le ship etait en vie
+    };
+
+    /// Statistiques d'un adversaire, cumulees sur la partie
+    struct OpponentStats
+    {
+        long long ship_turns = 0;    // Tours-ships observes
+        long long hunting_turns = 0; // Dont en HUNTING
+
+        /// Part des tours-ships passes en chasse
+        float aggression() const
+        {
+            return ship_turns > 0 ? static_cast<float>(hunting_turns) / static_cast<float>(ship_turns) : 0.f;
+        }
+
+        bool is_aggressive() const { return aggression() >= constants::ENEMY_AGGRESSIVE_RATIO; }
+    };
+
+    /// Suivi des ships ennemis d'un tour a l'autre, par id. update en O(allies + enemies),
+    /// les slots des ships morts sont recycles : pas d'allocation une fois la flotte max atteinte
+    class EnemyTracker
+    {
+    public:
+        /// Ajoute le tour courant a l'historique, oublie les ships disparus
+        void update(const std::vector<EnemyShipInfo> &enemies, const std::vector<hlt::Position> &allies,
+                    int width, int height);
+
+        /// Track de l'enemy id, nullptr s'il n'est pas en vie
+        const EnemyTrack *find(hlt::EntityId id) const
+        {
+            if (id < 0 || static_cast<size_t>(id) >= m_slot_of_id.size() || m_slot_of_id[id] < 0)
+                return nullptr;
+            return &m_tracks[m_slot_of_id[id]];
+        }
+
+        /// Stats de l'adversaire, vides s'il n'a jamais ete vu
+        const OpponentStats &opponent(hlt::PlayerId player_id) const
+        {
+            if (player_id < 0 || static_cast<size_t>(player_id) >= m_opponents.size())
+                return m_no_stats;
+            return m_opponents[player_id];
+        }
+
+        size_t size() const { return m_live.size(); }
+
+    private:
+        /// Distance a notre ship le plus proche par anneaux croissants, INT_MAX au-dela de
+        /// ENEMY_HUNT_DETECT_RADIUS : seul rayon utile a l'inference HUNTING
+        int nearest_ally_distance(const hlt::Position &pos) const;
+
+        void record(EnemyTrack &track, const EnemyShipInfo &enemy);
+
+        int m_width = 0;
+        int m_height = 0;
+        uint32_t m_generation = 0;
+
+        std::vector<EnemyTrack> m_tracks;     // Slots, recycles via m_free_slots
+        std::vector<uint32_t> m_free_slots;
+        std::vector<uint32_t> m_live;         // Slots en vie au dernier update
+        std::vector<uint32_t> m_next_live;
+        std::vector<int32_t> m_slot_of_id;    // Id -> slot, -1 si pas en vie
+        std::vector<OpponentStats> m_opponents; // Par player id
+        OpponentStats m_no_stats;
+
+        CellSet m_allies; // Cells de nos ships au dernier update
+    };
+} // namespace bot
@@ -1,79 +1,43 @@
 #pragma once
 
-#include <cstdarg>
 #include <cstddef>
 
-class FSM_STATE;
-
-class FSM_TRANSITION
-{
-
-public:
-    typedef float (*TRANSITION_CBK)(void *data);
-
-private:
-    TRANSITION_CBK m_transition_cbk;
-    FSM_STATE *m_output_state;
-    FSM_TRANSITION();
-
-public:
-    FSM_TRANSITION(TRANSITION_CBK cbk, FSM_STATE *outputState);
-
-    ~FSM_TRANSITION();
-
-    float Evaluate(void *data);
-
-    FSM_STATE *GetOutputState();
-};
-
-class FSM;
-
-class FSM_STATE
-{
-
-public:
-    typedef void (*BEHAVIOR_CBK)(void *data);
-
-private:
-    BEHAVIOR_CBK m_behavior_cbk;
-    FSM *m_sub_fsm;
-    FSM_TRANSITION **m_transitions;
-    size_t m_transitions_count;
-
-    FSM_STATE();
-
-public:
-    ~FSM_STATE();
-
-    FSM_STATE(BEHAVIOR_CBK cbk);
-    FSM_STATE(FSM *subFSM);
-
-    void InitTransitions(size_t count, ...);
-
-    FSM_STATE *Evaluate(void *data);
-
-    FSM_STATE *Behave(void *data);
-
-    void Reset();
-};
-
-class FSM
+namespace bot
 {
-
-    FSM_STATE **m_states;
-    FSM_STATE *m_current_state;
-    size_t m_states_count;
-
-    FSM();
-
-public:
-    ~FSM();
-
-    FSM(size_t count, ...);
-
-    FSM_STATE *Evaluate(void *data);
-
-    void Reset();
-
-    FSM_STATE *Behave(void *data);
-};
\ No newline at end of file
+    /// Transition d'un graphe d'etats statique : condition scoree puis etat de sortie
+    template <typename State, typename Condition>
+    struct FsmTransition
+    {
+        Condition condition;
+        State target;
+    };
+
+    /// Graphe d'etats defini a la compilation, partage par toutes les instances.
+    /// Les transitions de l'etat s sont transitions[offsets[s] .. offsets[s + 1]),
+    /// une instance ne stocke que l'index de son etat courant
+    template <typename State, typename Condition, size_t StateCount, size_t TransitionCount>
+    struct FsmGraph
+    {
+        size_t offsets[StateCount + 1];
+        FsmTransition<State, Condition> transitions[TransitionCount];
+    };
+
+    /// Evaluation groupee : les instances dans l'etat s sont les lignes [group_offsets[s], group_offsets[s + 1]).
+    /// Pour chaque etat, apply(transition, begin, end) teste la transition sur tout le groupe,
+    /// dans l'ordre de la table : a score egal, garder la premiere transition qui passe
+    template <typename State, typename Condition, size_t StateCount, size_t TransitionCount, typename ApplyFn>
+    inline void fsm_evaluate_groups(const FsmGraph<State, Condition, StateCount, TransitionCount> &graph,
+                                    const size_t (&group_offsets)[StateCount + 1], ApplyFn &&apply)
+    {
+        for (size_t state_index = 0; state_index < StateCount; ++state_index)
+        {
+            size_t begin = group_offsets[state_index];
+            size_t end = group_offsets[state_index + 1];
+            if (begin == end)
+                continue;
+
+            for (size_t i = graph.offsets[state_index]; i < graph.offsets[state_index + 1]; ++i)
+                apply(graph.transitions[i], begin, end);
+        }
+    }
+} // namespace bot
@@ -1,6 +1,10 @@
 #include "map_utils.hpp"
+#include "enemy_moves.hpp"
 #include "hlt/constants.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace bot
 {
     namespace map_utils
@@ -47,84 +51,88 @@ namespace bot
             return count;
         }
 
-        void navigate_toward(std::shared_ptr<hlt::Ship> ship,
+        void navigate_toward(const hlt::Ship &ship,
                              hlt::GameMap &game_map,
                              const hlt::Position &destination,
-                             const std::set<hlt::Position> &stuck_positions,
-                             const std::set<hlt::Position> &danger_zones,
+                             const CellSet &stuck_positions,
+                             const CellSet &danger_zones,
+                             const EnemyMoveMap &enemy_moves,
+                             float danger_occupancy,
                              hlt::Direction &out_best_dir,
-                             std::vector<hlt::Direction> &out_alternatives,
-                             bool is_returning)
+                             DirectionList &out_alternatives,
+                             bool is_returning,
+                             const hlt::Position &ignored_danger)
         {
             // Deja a destination : rester sur place
-            if (ship->position == destination)
+            if (ship.position == destination)
             {
                 out_best_dir = hlt::Direction::STILL;
-                out_alternatives.assign(hlt::ALL_CARDINALS.begin(), hlt::ALL_CARDINALS.end());
+                out_alternatives = DirectionList::cardinals();
 
                 return;
             }
 
             // Directions optimales vers la destination
-            std::vector<hlt::Direction> unsafe_moves = game_map.get_unsafe_moves(ship->position, destination);
+            hlt::Direction optimal_moves[2];
+            int optimal_count = game_map.get_unsafe_moves(ship.position, destination, optimal_moves);
+
+            // Score unique par direction : stuck > danger > optimal > dist > cost, dist * 1024 + cost
+            // reste sous NOT_OPTIMAL_PENALTY et l'ordre lexicographique est conserve
+            constexpr int NOT_OPTIMAL_PENALTY = -(1 << 20);
+            constexpr int MAX_MOVE_COST_SCORE = 1023;
 
-            // Scorer toutes les directions
             struct ScoredDir
             {
                 hlt::Direction dir;
-                int distance;
-                int move_cost;
-                bool is_stuck;
-                bool is_dangerous;
-                bool is_optimal;
+                int score;
             };
 
+            hlt::Position ignored_cell = ignored_danger.x >= 0 ? game_map.normalize(ignored_danger) : ignored_danger;
+
             // x4 move_cost en return pour eviter le burn
             int cost_weight = is_returning ? 4 : 1;
 
-            std::vector<ScoredDir> scored;
-            for (const auto &dir : hlt::ALL_CARDINALS)
+            std::array<ScoredDir, 4> scored;
+            for (size_t d = 0; d < hlt::ALL_CARDINALS.size(); ++d)
             {
-                hlt::Position target = game_map.normalize(ship->position.directional_offset(dir));
+                hlt::Direction dir = hlt::ALL_CARDINALS[d];
+                hlt::Position target = game_map.normalize(ship.position.directional_offset(dir));
                 int dist = game_map.calculate_distance(target, destination);
                 int cost = (game_map.at(target)->halite / hlt::constants::MOVE_COST_RATIO) * cost_weight;
 
-                bool stuck = stuck_positions.find(target) != stuck_positions.end();
-                bool dangerous = danger_zones.find(target) != danger_zones.end();
+                bool stuck = stuck_positions.contains(target);
+                bool dangerous = (danger_zones.contains(target) && target != ignored_cell) ||
+                                 enemy_moves.occupancy(target) >= danger_occupancy;
                 bool optimal = false;
 
-                for (const auto &um : unsafe_moves)
+                for (int i = 0; i < optimal_count; ++i)
                 {
-                    if (um == dir)
+                    if (optimal_moves[i] == dir)
                     {
                         optimal = true;
                         break;
                     }
                 }
 
-                scored.push_back({dir, dist, cost, stuck, dangerous, optimal});
+                int score = -(dist * 1024 + std::min(cost, MAX_MOVE_COST_SCORE));
+                if (!optimal)
+                    score += NOT_OPTIMAL_PENALTY;
+                if (dangerous)
+                    score += constants::MOVE_SCORE_UNSAFE;
+                if (stuck)
+                    score += constants::MOVE_SCORE_STUCK;
+
+                scored[d] = {dir, score};
             }
 
-            // Tri : stuck > danger > optimal > dist > cost
             std::sort(scored.begin(), scored.end(),
-                      [](const ScoredDir &a, const ScoredDir &b)
-                      {
-                          if (a.is_stuck != b.is_stuck)
-                              return !a.is_stuck;
-                          if (a.is_dangerous != b.is_dangerous)
-                              return !a.is_dangerous;
-                          if (a.is_optimal != b.is_optimal)
-                              return a.is_optimal;
-                          if (a.distance != b.distance)
-                              return a.distance < b.distance;
-                          return a.move_cost < b.move_cost;
-                      });
+                      [](const ScoredDir &a, const ScoredDir &b) { return a.score > b.score; });
 
             out_best_dir = scored[0].dir;
             out_alternatives.clear();
 
             for (size_t i = 1; i < scored.size(); ++i)
-                out_alternatives.push_back(scored[i].dir);
+                out_alternatives.push_back(scored[i].dir, scored[i].score);
         }
 
     } // namespace map_utils
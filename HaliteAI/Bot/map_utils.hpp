@@ -1,18 +1,20 @@
 #pragma once
 
+#include "move_request.hpp"
+#include "cell_set.hpp"
 #include "hlt/position.hpp"
 #include "hlt/direction.hpp"
 #include "hlt/game_map.hpp"
 #include "hlt/ship.hpp"
 
 #include <vector>
-#include <memory>
-#include <set>
 #include <cstdlib>
 #include <algorithm>
 
 namespace bot
 {
+    class EnemyMoveMap;
+
     namespace map_utils
     {
         /// Calcule la distance toroidale entre deux positions
@@ -54,15 +56,19 @@ namespace bot
                             const std::vector<hlt::Position> &positions,
                             int radius, int width, int height);
 
-        /// Navigue selon plusieurs criteres
-        void navigate_toward(std::shared_ptr<hlt::Ship> ship,
+        /// Navigue selon plusieurs criteres. Cell dangereuse : dans danger_zones (sauf ignored_danger,
+        /// (-1, -1) si aucune), ou occupation predite par enemy_moves >= danger_occupancy
+        void navigate_toward(const hlt::Ship &ship,
                              hlt::GameMap &game_map,
                              const hlt::Position &destination,
-                             const std::set<hlt::Position> &stuck_positions,
-                             const std::set<hlt::Position> &danger_zones,
+                             const CellSet &stuck_positions,
+                             const CellSet &danger_zones,
+                             const EnemyMoveMap &enemy_moves,
+                             float danger_occupancy,
                              hlt::Direction &out_best_dir,
-                             std::vector<hlt::Direction> &out_alternatives,
-                             bool is_returning = false);
+                             DirectionList &out_alternatives,
+                             bool is_returning = false,
+                             const hlt::Position &ignored_danger = hlt::Position(-1, -1));
 
     } // namespace map_utils
 } // namespace bot
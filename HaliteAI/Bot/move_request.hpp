@@ -4,11 +4,59 @@
 #include "hlt/entity.hpp"
 #include "hlt/position.hpp"
 #include "hlt/direction.hpp"
+#include "turn_arena.hpp"
 
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace bot
 {
+    /// Directions candidates d'un ship, rangees par preference decroissante, avec leur score.
+    /// Score plus haut = meilleur, comparable au sein d'une liste, <= MOVE_SCORE_UNSAFE pour un move
+    /// que l'etat juge dangereux. Taille fixe : un ship a au plus 5 moves, la liste reste trivialement copiable
+    class DirectionList
+    {
+    public:
+        static constexpr size_t CAPACITY = 5;
+
+        /// Les 4 cardinaux, score neutre
+        static DirectionList cardinals()
+        {
+            DirectionList list;
+            for (const auto &dir : hlt::ALL_CARDINALS)
+                list.push_back(dir);
+            return list;
+        }
+
+        void push_back(hlt::Direction dir, int score = 0)
+        {
+            m_directions[m_size] = dir;
+            m_scores[m_size] = score;
+            ++m_size;
+        }
+
+        void clear() { m_size = 0; }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        /// Direction de rang i, modifiable sans toucher a son score
+        hlt::Direction &operator[](size_t i) { return m_directions[i]; }
+        hlt::Direction operator[](size_t i) const { return m_directions[i]; }
+
+        int score(size_t i) const { return m_scores[i]; }
+
+        const hlt::Direction *begin() const { return m_directions.data(); }
+        const hlt::Direction *end() const { return m_directions.data() + m_size; }
+
+    private:
+        std::array<hlt::Direction, CAPACITY> m_directions;
+        std::array<int, CAPACITY> m_scores;
+        uint8_t m_size = 0;
+    };
+
     struct MoveRequest
     {
         hlt::EntityId m_ship_id;                    // Id du ship
@@ -16,13 +64,18 @@ namespace bot
         hlt::Position m_desired;                    // Position souhaitee
         hlt::Direction m_desired_direction;         // Direction souhaitee
         int m_priority;                             // Priorite de traitement
-        std::vector<hlt::Direction> m_alternatives; // Directions secondaires
+        DirectionList m_alternatives;               // Directions secondaires
     };
 
+    static_assert(std::is_trivially_copyable<MoveRequest>::value, "MoveRequest doit rester copiable par memcpy");
+
     struct MoveResult
     {
         hlt::EntityId m_ship_id;          // Id du ship
         hlt::Direction m_final_direction; // Direction finale du tour
     };
 
+    using MoveRequests = ArenaVector<MoveRequest>;
+    using MoveResults = ArenaVector<MoveResult>;
+
 } // namespace bot
@@ -0,0 +1,57 @@
+#include "position_history.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    constexpr int ShipTrail::LENGTH;
+
+    void PositionHistory::record(uint32_t slot, const hlt::Position &pos,
+                                 const hlt::Position &target, int target_distance)
+    {
+        ShipTrail &trail = m_trails[slot];
+        if (trail.count > 0)
+            trail.head = (trail.head + 1) % ShipTrail::LENGTH;
+        trail.positions[trail.head] = pos;
+        trail.count = std::min(trail.count + 1, ShipTrail::LENGTH);
+
+        trail.cycling = has_cycle(trail);
+
+        // Stall : compte les tours sans battre la meilleure distance au target. Arrive, il mine.
+        // Un stall n'est signale qu'un tour : le suivi repart, meme si le ship reprend le meme target
+        if (target.x < 0 || target != trail.target || trail.stall_turns >= constants::POSITION_STALL_TURNS)
+        {
+            trail.target = target;
+            trail.best_target_distance = target_distance;
+            trail.stall_turns = 0;
+        }
+        else if (target_distance < trail.best_target_distance || target_distance == 0)
+        {
+            trail.best_target_distance = target_distance;
+            trail.stall_turns = 0;
+        }
+        else
+        {
+            ++trail.stall_turns;
+        }
+    }
+
+    bool PositionHistory::has_cycle(const ShipTrail &trail)
+    {
+        for (int period = 2; 2 * period <= trail.count; ++period)
+        {
+            bool repeats = true;
+            bool moved = false;
+            for (int age = 0; age < period && repeats; ++age)
+            {
+                repeats = trail.position(age) == trail.position(age + period);
+                moved = moved || trail.position(age) != trail.position(0);
+            }
+
+            if (repeats && moved)
+                return true;
+        }
+
+        return false;
+    }
+} // namespace bot
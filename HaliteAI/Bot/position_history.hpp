@@ -0,0 +1,66 @@
+#pragma once
+
+#include "bot_constants.hpp"
+#include "hlt/position.hpp"
+#include "hlt/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    /// Dernieres positions d'un de nos ships, buffer circulaire, la plus recente a head
+    struct ShipTrail
+    {
+        static constexpr int LENGTH = 2 * constants::POSITION_CYCLE_MAX_LENGTH;
+
+        int count = 0; // Tours enregistres, <= LENGTH
+        int head = 0;
+        std::array<hlt::Position, LENGTH> positions;
+
+        hlt::Position target = hlt::Position(-1, -1); // Target suivi pour le stall, (-1, -1) si aucun
+        int best_target_distance = 0;                 // Plus courte distance au target depuis qu'il est suivi
+        int stall_turns = 0;                          // Tours sans se rapprocher du target
+
+        bool cycling = false;
+
+        /// Position il y a age tours (age < count)
+        const hlt::Position &position(int age = 0) const { return positions[(head + LENGTH - age) % LENGTH]; }
+    };
+
+    /// Historique des positions de nos ships, une colonne indexee par slot de ShipSlots.
+    /// record en O(POSITION_CYCLE_MAX_LENGTH^2) par ship, independant de la flotte
+    class PositionHistory
+    {
+    public:
+        /// Dimensionne la colonne a capacity slots
+        void resize(size_t capacity) { m_trails.resize(capacity); }
+
+        /// Vide l'historique du slot, pour un ship qui vient de l'obtenir
+        void reset(uint32_t slot) { m_trails[slot] = ShipTrail(); }
+
+        /// Ajoute pos a l'historique du slot et met a jour cycle et stall.
+        /// target (-1, -1) si le ship n'en suit pas, target_distance sa distance au target
+        void record(uint32_t slot, const hlt::Position &pos,
+                    const hlt::Position &target, int target_distance);
+
+        /// Le ship repete un cycle de 2 a POSITION_CYCLE_MAX_LENGTH positions
+        bool is_cycling(uint32_t slot) const { return m_trails[slot].cycling; }
+
+        /// Le ship ne s'est pas rapproche de son target depuis POSITION_STALL_TURNS tours
+        bool is_stalled(uint32_t slot) const
+        {
+            return m_trails[slot].stall_turns >= constants::POSITION_STALL_TURNS;
+        }
+
+        const ShipTrail &trail(uint32_t slot) const { return m_trails[slot]; }
+
+    private:
+        /// Les 2p dernieres positions se repetent avec une periode p, sans etre toutes identiques
+        static bool has_cycle(const ShipTrail &trail);
+
+        std::vector<ShipTrail> m_trails;
+    };
+} // namespace bot
@@ -0,0 +1,49 @@
+#include "ship_features.hpp"
+#include "blackboard.hpp"
+#include "hlt/constants.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    ShipFeatures compute_ship_features(const hlt::Ship &ship, hlt::GameMap &game_map,
+                                       const hlt::Position &depot_position, const Blackboard &bb)
+    {
+        ShipFeatures features;
+
+        // Extraction marginale, meme calcul que l'engine
+        features.cell_halite = game_map.at(ship.position)->halite;
+        features.inspired = bb.inspired_zones.contains(ship.position);
+
+        int extract_ratio = features.inspired ? hlt::constants::INSPIRED_EXTRACT_RATIO : hlt::constants::EXTRACT_RATIO;
+        features.marginal_yield = features.cell_halite / extract_ratio;
+        if (features.inspired)
+            features.marginal_yield += static_cast<int>(features.marginal_yield * hlt::constants::INSPIRED_BONUS_MULTIPLIER);
+
+        features.average_yield = (bb.average_halite > 0 ? bb.average_halite : 1) / 6;
+        features.depot_distance = game_map.calculate_distance(ship.position, depot_position);
+
+        // Proies limitees au rayon de chasse par l'index, target de chasse par id
+        int hunt_radius = (bb.current_phase == GamePhase::LATE) ? bb.params.hunt_radius_late : bb.params.hunt_radius;
+        int hunt_min_halite = bb.params.hunt_min_enemy_halite;
+        features.nearest_prey_distance = bb.enemy_index.nearest_distance(
+            ship.position, hunt_radius,
+            [hunt_min_halite](const EnemyShipInfo &enemy) { return enemy.halite >= hunt_min_halite; });
+
+        hlt::EntityId hunt_target = bb.hunt_target(ship.id);
+        if (hunt_target >= 0)
+        {
+            int target_index = bb.enemy_index.find(hunt_target);
+            features.hunt_target_valid = target_index >= 0 &&
+                                         bb.enemy_ships[target_index].halite >= hunt_min_halite / 2;
+        }
+
+        features.threatened = bb.has_nearby_threat(game_map, ship.position, ship.halite);
+
+        features.can_hunt = bb.current_phase != GamePhase::ENDGAME &&
+                            ship.halite <= bb.params.hunt_max_own_halite &&
+                            features.nearest_prey_distance <= hunt_radius;
+
+        return features;
+    }
+} // namespace bot
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "hlt/entity.hpp"
+#include "hlt/game_map.hpp"
+#include "hlt/position.hpp"
+#include "hlt/ship.hpp"
+
+#include <climits>
+
+namespace bot
+{
+    struct Blackboard;
+
+    /// Mesures d'un ship calculees une fois par tour, lues par les transitions et les states
+    struct ShipFeatures
+    {
+        int cell_halite = 0;                   // Halite sous le ship
+        bool inspired = false;                 // Cell dans inspired_zones
+        int marginal_yield = 0;                // Halite extrait ce tour, bonus d'inspiration inclus
+        int average_yield = 0;                 // Rendement moyen par tour d'un trip (~6 tours)
+        int depot_distance = 0;                // Distance au dropoff ou shipyard le plus proche
+        int nearest_prey_distance = INT_MAX;   // Enemy assez plein pour la chasse, INT_MAX si aucun dans le rayon de chasse
+        bool threatened = false;               // Blackboard::has_nearby_threat, lu dans threat_field
+        bool can_hunt = false;                 // Proie a portee et ship assez leger, hors ENDGAME
+        bool hunt_target_valid = false;        // Target de hunt_targets encore en vie et plein
+    };
+
+    /// Menace lue dans Blackboard::threat_field, chasse par requetes de rayon sur enemy_index
+    ShipFeatures compute_ship_features(const hlt::Ship &ship, hlt::GameMap &game_map,
+                                       const hlt::Position &depot_position, const Blackboard &bb);
+} // namespace bot
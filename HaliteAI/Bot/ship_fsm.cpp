@@ -1,380 +1,236 @@
 #include "ship_fsm.hpp"
 #include "ship_states.hpp"
+#include "ship_table.hpp"
 #include "blackboard.hpp"
 #include "hlt/constants.hpp"
 
 namespace bot
 {
-    // TRANSITION CALLBACKS
-
-    float ShipFSM::transition_is_full(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-
-        // Classique : ship plein a 90%
-        if (ctx->ship->halite >= hlt::constants::MAX_HALITE * constants::HALITE_FILL_THRESHOLD)
-            return 1.0f;
-
-        // Si le rendement du trajet retour (cargo / dist) est meilleur que 2x le rendement moyen d'extraction par tour, return
-        const Blackboard &bb = Blackboard::get_instance();
-
-        // Distance au dropoff
-        int dist = ctx->game_map->calculate_distance(ctx->ship->position, ctx->drop_position);
-        if (dist <= 0 || ctx->ship->halite <= 0)
-            return 0.0f;
-
-        // Halite par tour en retournant maintenant
-        int halite_per_turn_returning = ctx->ship->halite / dist;
-        int avg_mining_yield = bb.average_halite / hlt::constants::EXTRACT_RATIO;
-
-        if (halite_per_turn_returning > avg_mining_yield * 2)
-            return 1.0f;
-
-        return 0.0f;
-    }
-
-    // Si on est proche du dropoff et qu'on a un bon cargo, on peut retourner vite
-    float ShipFSM::transition_close_and_loaded(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-
-        int dist = ctx->game_map->calculate_distance(ctx->ship->position, ctx->drop_position);
-
-        if (dist <= constants::SMART_RETURN_MAX_DIST &&
-            ctx->ship->halite >= hlt::constants::MAX_HALITE * constants::SMART_RETURN_CARGO_RATIO)
-            return 0.6f;
-
-        return 0.0f;
-    }
-
-    // Si la cell a du halite, c'est qu'elle n'est pas encore epuisee, on peut rester miner
-    float ShipFSM::transition_cell_has_halite(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        int cell_halite = ctx->game_map->at(ctx->ship->position)->halite;
-        int extract_ratio = hlt::constants::EXTRACT_RATIO;
-        bool inspired = bb.inspired_zones.find(ctx->game_map->normalize(ctx->ship->position)) != bb.inspired_zones.end();
-
-        if (inspired)
-            extract_ratio = hlt::constants::INSPIRED_EXTRACT_RATIO;
-
-        // Marginal = halite qu'on extrairait ce tour
-        int marginal = cell_halite / extract_ratio;
-        if (inspired)
-            marginal += static_cast<int>(marginal * hlt::constants::INSPIRED_BONUS_MULTIPLIER);
-
-        // Rendement moyen par tour d'un trip complet (6 tours : aller, miner, retour)
-        int avg_yield = (bb.average_halite > 0 ? bb.average_halite : 1) / 6;
-
-        // Cell encore rentable, on peut rester
-        if (marginal > avg_yield)
-            return 0.5f;
-
-        return 0.0f;
-    }
-
-    // Inverse de transition_cell_has_halite : cell epuisee, faut bouger
-    float ShipFSM::transition_cell_empty(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        int cell_halite = ctx->game_map->at(ctx->ship->position)->halite;
-        int extract_ratio = hlt::constants::EXTRACT_RATIO;
-
-        bool inspired = bb.inspired_zones.find(ctx->game_map->normalize(ctx->ship->position)) != bb.inspired_zones.end();
-        if (inspired)
-            extract_ratio = hlt::constants::INSPIRED_EXTRACT_RATIO;
-
-        int marginal = cell_halite / extract_ratio;
-        if (inspired)
-            marginal += static_cast<int>(marginal * hlt::constants::INSPIRED_BONUS_MULTIPLIER);
-
-        int avg_yield = (bb.average_halite > 0 ? bb.average_halite : 1) / 6;
-
-        // Marginal trop faible, cell epuisee, faut partir
-        if (marginal < avg_yield)
-            return 0.5f;
-
-        return 0.0f;
-    }
-
-    // Si on est sur le dropoff, on peut switch de suite en explore pour repartir miner
-    float ShipFSM::transition_at_shipyard(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        if (ctx->ship->position == ctx->drop_position)
-            return 1.0f;
-
-        return 0.0f;
-    }
-
-    // Si on est a moins de SAFE_RETURN_TURNS du game end, il faut retourner absolument
-    float ShipFSM::transition_urgent_return(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        int dist = ctx->game_map->calculate_distance(ctx->ship->position, ctx->drop_position);
-
-        if (ctx->turns_remaining < dist + constants::SAFE_RETURN_TURNS)
-            return 2.0f;
-
-        return 0.0f;
-    }
-
-    // Transition toujours valide
-    float ShipFSM::transition_always(void *data)
-    {
-        return 1.0f;
-    }
-
-    // Si on est en phase de chasse et qu'on a une cible valide a portee, switch en hunt
-    float ShipFSM::transition_should_hunt(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        // Pas de chasse en ENDGAME
-        if (bb.current_phase == GamePhase::ENDGAME)
-            return 0.0f;
-
-        // Notre ship doit etre leger
-        if (ctx->ship->halite > constants::HUNT_MAX_OWN_HALITE)
-            return 0.0f;
-
-        int search_radius = (bb.current_phase == GamePhase::LATE)
-                                ? constants::HUNT_RADIUS_LATE
-                                : constants::HUNT_RADIUS;
-
-        // Chercher un enemy plein a portee
-        for (const auto &enemy : bb.enemy_ships)
+    namespace
+    {
+        constexpr size_t SHIP_TRANSITION_COUNT = 20;
+
+        // Graphe des ships, transitions dans l'ordre d'evaluation (la premiere gagne a score egal)
+        constexpr FsmGraph<ShipState, ShipCondition, SHIP_STATE_COUNT, SHIP_TRANSITION_COUNT> SHIP_GRAPH = {
+            {0, 6, 12, 14, 15, 17, 20},
+            {
+                // EXPLORE
+                {ShipCondition::URGENT_RETURN, ShipState::URGENT_RETURN},
+                {ShipCondition::SHOULD_FLEE, ShipState::FLEE},
+                {ShipCondition::IS_FULL, ShipState::RETURN},
+                {ShipCondition::CLOSE_AND_LOADED, ShipState::RETURN},
+                {ShipCondition::SHOULD_HUNT, ShipState::HUNT},
+                {ShipCondition::CELL_HAS_HALITE, ShipState::COLLECT},
+
+                // COLLECT
+                {ShipCondition::URGENT_RETURN, ShipState::URGENT_RETURN},
+                {ShipCondition::SHOULD_FLEE, ShipState::FLEE},
+                {ShipCondition::IS_FULL, ShipState::RETURN},
+                {ShipCondition::CLOSE_AND_LOADED, ShipState::RETURN},
+                {ShipCondition::SHOULD_HUNT, ShipState::HUNT},
+                {ShipCondition::CELL_EMPTY, ShipState::EXPLORE},
+
+                // RETURN
+                {ShipCondition::URGENT_RETURN, ShipState::URGENT_RETURN},
+                {ShipCondition::AT_SHIPYARD, ShipState::EXPLORE},
+
+                // URGENT_RETURN
+                {ShipCondition::AT_SHIPYARD, ShipState::EXPLORE},
+
+                // FLEE
+                {ShipCondition::URGENT_RETURN, ShipState::URGENT_RETURN},
+                {ShipCondition::NO_THREAT, ShipState::EXPLORE},
+
+                // HUNT
+                {ShipCondition::URGENT_RETURN, ShipState::URGENT_RETURN},
+                {ShipCondition::SHOULD_FLEE, ShipState::FLEE},
+                {ShipCondition::NO_HUNT_TARGET, ShipState::EXPLORE},
+            }};
+
+        static_assert(SHIP_GRAPH.offsets[SHIP_STATE_COUNT] == SHIP_TRANSITION_COUNT,
+                      "offsets du graphe des ships incoherents avec la table");
+
+        template <typename StateType>
+        void execute_state(ShipFSMContext &ctx, Stage stage)
         {
-            if (enemy.halite < constants::HUNT_MIN_ENEMY_HALITE)
-                continue;
-
-            int dist = ctx->game_map->calculate_distance(ctx->ship->position, enemy.position);
-
-            if (dist <= search_radius)
-                return 0.8f;
+            BOT_STAGE_TIMER(ctx.blackboard->profiler, stage);
+            (void)stage;
+            ctx.result_move_request = StateType::execute(*ctx.ship, *ctx.game_map, ctx.drop_position,
+                                                         *ctx.blackboard, *ctx.features, *ctx.intent);
         }
 
-        return 0.0f;
-    }
-
-    // Si on est en chasse mais qu'on n'a plus de cible valide, retourner en explore
-    float ShipFSM::transition_should_flee(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        if (bb.has_nearby_threat(*ctx->game_map, ctx->ship->position, ctx->ship->halite))
-            return 1.2f;
-
-        return 0.0f;
-    }
-
-    // Si on est en chasse mais qu'on a plus de cible valide, retourner en explore
-    float ShipFSM::transition_no_hunt_target(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        // Si plus de target valide, return to explore
-        auto ht_it = bb.hunt_targets.find(ctx->ship->id);
-        if (ht_it == bb.hunt_targets.end())
-            return 0.5f;
-
-        // Verif si la target existe encore et est toujours plein
-        for (const auto &enemy : bb.enemy_ships)
+        // Valeurs communes a tous les ships pour les tests de transition
+        struct TransitionInputs
         {
-            if (enemy.id == ht_it->second && enemy.halite >= constants::HUNT_MIN_ENEMY_HALITE / 2)
-                return 0.0f; // target encore valide
+            float full_cargo;
+            float smart_return_cargo;
+            int smart_return_max_dist;
+            int avg_mining_yield;   // Extraction moyenne par tour sur la map
+            int average_yield;      // Rendement moyen par tour d'un trip (~6 tours)
+            int safe_return_turns;
+            int turns_remaining;
+        };
+
+        // Applique la transition aux lignes [begin, end) qui passent le test et battent leur meilleur score
+        template <typename Predicate>
+        void select_rows(ShipTable &table, size_t begin, size_t end, float score, ShipState target, Predicate passes)
+        {
+            float *best_scores = table.best_scores.data();
+            ShipState *next_states = table.next_states.data();
+
+            for (size_t r = begin; r < end; ++r)
+            {
+                bool take = passes(r) && score > best_scores[r];
+                best_scores[r] = take ? score : best_scores[r];
+                next_states[r] = take ? target : next_states[r];
+            }
         }
 
-        return 0.5f; // target perdue
-    }
-
-    // Si on est en flee mais qu'il y a plus de menace proche, on peut retourner en explore
-    float ShipFSM::transition_no_threat(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        const Blackboard &bb = Blackboard::get_instance();
-
-        if (!bb.has_nearby_threat(*ctx->game_map, ctx->ship->position, ctx->ship->halite))
-            return 0.5f;
-
-        return 0.0f;
-    }
-
-    void ShipFSM::behavior_explore(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipExploreState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
-    }
-
-    void ShipFSM::behavior_collect(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipCollectState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
-    }
-
-    void ShipFSM::behavior_return(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipReturnState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
-    }
+        // Une transition sur tout le groupe d'un etat : un test par condition, sur les colonnes de la table
+        void apply_transition(ShipTable &table, const FsmTransition<ShipState, ShipCondition> &transition,
+                              size_t begin, size_t end, const TransitionInputs &in)
+        {
+            const int *cargo = table.cargo.data();
+            const int *depot_distance = table.depot_distance.data();
+            const int *marginal_yield = table.marginal_yield.data();
+            const uint8_t *threatened = table.threatened.data();
+            const uint8_t *can_hunt = table.can_hunt.data();
+            const uint8_t *hunt_target_valid = table.hunt_target_valid.data();
+            ShipState target = transition.target;
+
+            switch (transition.condition)
+            {
+            // Plein a 90%, ou le cargo par tour de retour bat 2x l'extraction moyenne par tour
+            case ShipCondition::IS_FULL:
+                select_rows(table, begin, end, 1.0f, target, [&](size_t r)
+                            { return cargo[r] >= in.full_cargo ||
+                                     (depot_distance[r] > 0 && cargo[r] > 0 &&
+                                      cargo[r] / depot_distance[r] > in.avg_mining_yield * 2); });
+                break;
+
+            // Proche du dropoff avec un bon cargo, on peut retourner vite
+            case ShipCondition::CLOSE_AND_LOADED:
+                select_rows(table, begin, end, 0.6f, target, [&](size_t r)
+                            { return depot_distance[r] <= in.smart_return_max_dist && cargo[r] >= in.smart_return_cargo; });
+                break;
+
+            // L'extraction de la cell bat le rendement moyen d'un trip, on peut rester miner
+            case ShipCondition::CELL_HAS_HALITE:
+                select_rows(table, begin, end, 0.5f, target, [&](size_t r)
+                            { return marginal_yield[r] > in.average_yield; });
+                break;
+
+            // Cell epuisee, faut bouger
+            case ShipCondition::CELL_EMPTY:
+                select_rows(table, begin, end, 0.5f, target, [&](size_t r)
+                            { return marginal_yield[r] < in.average_yield; });
+                break;
+
+            // Sur le dropoff, on peut switch de suite en explore pour repartir miner
+            case ShipCondition::AT_SHIPYARD:
+                select_rows(table, begin, end, 1.0f, target, [&](size_t r)
+                            { return depot_distance[r] == 0; });
+                break;
+
+            // A moins de SAFE_RETURN_TURNS du game end, il faut retourner absolument
+            case ShipCondition::URGENT_RETURN:
+                select_rows(table, begin, end, 2.0f, target, [&](size_t r)
+                            { return in.turns_remaining < depot_distance[r] + in.safe_return_turns; });
+                break;
+
+            // Ship leger avec un enemy plein a portee, hors ENDGAME
+            case ShipCondition::SHOULD_HUNT:
+                select_rows(table, begin, end, 0.8f, target, [&](size_t r)
+                            { return can_hunt[r] != 0; });
+                break;
+
+            // Enemy plus leger a portee d'un ship charge
+            case ShipCondition::SHOULD_FLEE:
+                select_rows(table, begin, end, 1.2f, target, [&](size_t r)
+                            { return threatened[r] != 0; });
+                break;
+
+            // En chasse sans cible valide, retour en explore
+            case ShipCondition::NO_HUNT_TARGET:
+                select_rows(table, begin, end, 0.5f, target, [&](size_t r)
+                            { return hunt_target_valid[r] == 0; });
+                break;
+
+            // En flee sans menace proche, retour en explore
+            case ShipCondition::NO_THREAT:
+                select_rows(table, begin, end, 0.5f, target, [&](size_t r)
+                            { return threatened[r] == 0; });
+                break;
+            }
+        }
+    } // namespace
 
-    void ShipFSM::behavior_urgent_return(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipUrgentReturnState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
-    }
+    // TRANSITIONS
 
-    void ShipFSM::behavior_flee(void *data)
+    // Groupe par groupe : les ships d'un meme etat testent ses transitions dans l'ordre de la table
+    void ShipFSM::evaluate_transitions(ShipTable &table, const Blackboard &bb, int turns_remaining)
     {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipFleeState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
-    }
+        TransitionInputs inputs;
+        inputs.full_cargo = hlt::constants::MAX_HALITE * bb.params.halite_fill_threshold;
+        inputs.smart_return_cargo = hlt::constants::MAX_HALITE * bb.params.smart_return_cargo_ratio;
+        inputs.smart_return_max_dist = bb.params.smart_return_max_dist;
+        inputs.avg_mining_yield = bb.average_halite / hlt::constants::EXTRACT_RATIO;
+        inputs.average_yield = (bb.average_halite > 0 ? bb.average_halite : 1) / 6;
+        inputs.safe_return_turns = bb.params.safe_return_turns;
+        inputs.turns_remaining = turns_remaining;
 
-    void ShipFSM::behavior_hunt(void *data)
-    {
-        auto *ctx = static_cast<ShipFSMContext *>(data);
-        ctx->result_move_request = ShipHuntState::execute(ctx->ship, *ctx->game_map, ctx->drop_position);
+        fsm_evaluate_groups(SHIP_GRAPH, table.group_offsets,
+                            [&table, &inputs](const FsmTransition<ShipState, ShipCondition> &transition,
+                                              size_t begin, size_t end)
+                            { apply_transition(table, transition, begin, end, inputs); });
     }
 
-    ShipFSM::ShipFSM(hlt::EntityId ship_id)
-        : m_ship_id(ship_id), m_fsm(nullptr)
-    {
-        m_state_explore = new FSM_STATE(&ShipFSM::behavior_explore);
-        m_state_collect = new FSM_STATE(&ShipFSM::behavior_collect);
-        m_state_return = new FSM_STATE(&ShipFSM::behavior_return);
-        m_state_urgent_return = new FSM_STATE(&ShipFSM::behavior_urgent_return);
-        m_state_flee = new FSM_STATE(&ShipFSM::behavior_flee);
-        m_state_hunt = new FSM_STATE(&ShipFSM::behavior_hunt);
-
-        // Transitions depuis EXPLORE
-        m_trans_explore_to_urgent = new FSM_TRANSITION(&ShipFSM::transition_urgent_return, m_state_urgent_return);
-        m_trans_explore_to_flee = new FSM_TRANSITION(&ShipFSM::transition_should_flee, m_state_flee);
-        m_trans_explore_to_return = new FSM_TRANSITION(&ShipFSM::transition_is_full, m_state_return);
-        m_trans_explore_to_close_return = new FSM_TRANSITION(&ShipFSM::transition_close_and_loaded, m_state_return);
-        m_trans_explore_to_hunt = new FSM_TRANSITION(&ShipFSM::transition_should_hunt, m_state_hunt);
-        m_trans_explore_to_collect = new FSM_TRANSITION(&ShipFSM::transition_cell_has_halite, m_state_collect);
-
-        // Transitions depuis COLLECT
-        m_trans_collect_to_urgent = new FSM_TRANSITION(&ShipFSM::transition_urgent_return, m_state_urgent_return);
-        m_trans_collect_to_flee = new FSM_TRANSITION(&ShipFSM::transition_should_flee, m_state_flee);
-        m_trans_collect_to_return = new FSM_TRANSITION(&ShipFSM::transition_is_full, m_state_return);
-        m_trans_collect_to_close_return = new FSM_TRANSITION(&ShipFSM::transition_close_and_loaded, m_state_return);
-        m_trans_collect_to_hunt = new FSM_TRANSITION(&ShipFSM::transition_should_hunt, m_state_hunt);
-        m_trans_collect_to_explore = new FSM_TRANSITION(&ShipFSM::transition_cell_empty, m_state_explore);
-
-        // Transitions depuis RETURN
-        m_trans_return_to_urgent = new FSM_TRANSITION(&ShipFSM::transition_urgent_return, m_state_urgent_return);
-        m_trans_return_to_explore = new FSM_TRANSITION(&ShipFSM::transition_at_shipyard, m_state_explore);
-
-        // Transitions depuis FLEE
-        m_trans_flee_to_urgent = new FSM_TRANSITION(&ShipFSM::transition_urgent_return, m_state_urgent_return);
-        m_trans_flee_to_explore = new FSM_TRANSITION(&ShipFSM::transition_no_threat, m_state_explore);
-
-        // Transitions depuis HUNT
-        m_trans_hunt_to_urgent = new FSM_TRANSITION(&ShipFSM::transition_urgent_return, m_state_urgent_return);
-        m_trans_hunt_to_flee = new FSM_TRANSITION(&ShipFSM::transition_should_flee, m_state_flee);
-        m_trans_hunt_to_explore = new FSM_TRANSITION(&ShipFSM::transition_no_hunt_target, m_state_explore);
-
-        // Initialisation des transitions dans les etats
-        m_state_explore->InitTransitions(6,
-                                         m_trans_explore_to_urgent,
-                                         m_trans_explore_to_flee,
-                                         m_trans_explore_to_return,
-                                         m_trans_explore_to_close_return,
-                                         m_trans_explore_to_hunt,
-                                         m_trans_explore_to_collect);
-
-        m_state_collect->InitTransitions(6,
-                                         m_trans_collect_to_urgent,
-                                         m_trans_collect_to_flee,
-                                         m_trans_collect_to_return,
-                                         m_trans_collect_to_close_return,
-                                         m_trans_collect_to_hunt,
-                                         m_trans_collect_to_explore);
-
-        m_state_return->InitTransitions(2,
-                                        m_trans_return_to_urgent,
-                                        m_trans_return_to_explore);
-
-        m_state_urgent_return->InitTransitions(1,
-                                               m_trans_return_to_explore);
+    // BEHAVIORS
 
-        m_state_flee->InitTransitions(2,
-                                      m_trans_flee_to_urgent,
-                                      m_trans_flee_to_explore);
-
-        m_state_hunt->InitTransitions(3,
-                                      m_trans_hunt_to_urgent,
-                                      m_trans_hunt_to_flee,
-                                      m_trans_hunt_to_explore);
-
-        m_fsm = new FSM(6,
-                        m_state_explore,
-                        m_state_collect,
-                        m_state_return,
-                        m_state_urgent_return,
-                        m_state_flee,
-                        m_state_hunt);
-    }
-
-    ShipFSM::~ShipFSM()
+    void ShipFSM::run_behavior(ShipState state, ShipFSMContext &ctx)
     {
-        delete m_fsm;
-
-        delete m_state_explore;
-        delete m_state_collect;
-        delete m_state_return;
-        delete m_state_urgent_return;
-        delete m_state_flee;
-        delete m_state_hunt;
-
-        delete m_trans_explore_to_return;
-        delete m_trans_explore_to_close_return;
-        delete m_trans_explore_to_collect;
-        delete m_trans_explore_to_urgent;
-        delete m_trans_explore_to_hunt;
-        delete m_trans_explore_to_flee;
-
-        delete m_trans_collect_to_return;
-        delete m_trans_collect_to_close_return;
-        delete m_trans_collect_to_explore;
-        delete m_trans_collect_to_urgent;
-        delete m_trans_collect_to_hunt;
-        delete m_trans_collect_to_flee;
-
-        delete m_trans_return_to_explore;
-        delete m_trans_return_to_urgent;
-
-        delete m_trans_flee_to_explore;
-        delete m_trans_flee_to_urgent;
-
-        delete m_trans_hunt_to_explore;
-        delete m_trans_hunt_to_urgent;
-        delete m_trans_hunt_to_flee;
+        switch (state)
+        {
+        case ShipState::EXPLORE:
+            execute_state<ShipExploreState>(ctx, Stage::STATE_EXPLORE);
+            break;
+        case ShipState::COLLECT:
+            execute_state<ShipCollectState>(ctx, Stage::STATE_COLLECT);
+            break;
+        case ShipState::RETURN:
+            execute_state<ShipReturnState>(ctx, Stage::STATE_RETURN);
+            break;
+        case ShipState::URGENT_RETURN:
+            execute_state<ShipUrgentReturnState>(ctx, Stage::STATE_URGENT_RETURN);
+            break;
+        case ShipState::FLEE:
+            execute_state<ShipFleeState>(ctx, Stage::STATE_FLEE);
+            break;
+        case ShipState::HUNT:
+            execute_state<ShipHuntState>(ctx, Stage::STATE_HUNT);
+            break;
+        case ShipState::COUNT:
+            break;
+        }
     }
 
-    // Update le FSM et execute le behavior du current state, retourne le MoveRequest genere
-    MoveRequest ShipFSM::update(std::shared_ptr<hlt::Ship> ship, hlt::GameMap &game_map,
-                                const hlt::Position &depot_position, int turns_remaining)
+    // Execute le behavior du current state, retourne le MoveRequest genere
+    MoveRequest ShipFSM::behave(const hlt::Ship &ship, hlt::GameMap &game_map,
+                                const hlt::Position &depot_position, int turns_remaining,
+                                const Blackboard &bb, const ShipFeatures &features, ShipIntent &intent)
     {
         ShipFSMContext context;
-        context.ship = ship;
+        context.ship = &ship;
         context.game_map = &game_map;
         context.drop_position = depot_position;
         context.turns_remaining = turns_remaining;
+        context.blackboard = &bb;
+        context.features = &features;
+        context.intent = &intent;
         context.result_move_request = MoveRequest{};
 
-        m_fsm->Evaluate(&context);
-
-        m_fsm->Behave(&context);
+        run_behavior(m_state, context);
 
         return context.result_move_request;
     }
-} // namespace bot
\ No newline at end of file
+} // namespace bot
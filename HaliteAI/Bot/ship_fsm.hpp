@@ -2,6 +2,8 @@
 
 #include "fsm.hpp"
 #include "move_request.hpp"
+#include "ship_intent.hpp"
+#include "ship_features.hpp"
 #include "bot_constants.hpp"
 #include "hlt/command.hpp"
 #include "hlt/entity.hpp"
@@ -9,88 +11,78 @@
 #include "hlt/position.hpp"
 #include "hlt/ship.hpp"
 
-#include <memory>
+#include <cstdint>
 
 namespace bot
 {
+  struct Blackboard;
+
   struct ShipFSMContext
   {
-    std::shared_ptr<hlt::Ship> ship;
+    const hlt::Ship *ship;
+    const Blackboard *blackboard; // Lecture seule pendant la phase de decision
+    const ShipFeatures *features; // Mesures du ship pour ce tour
     hlt::GameMap *game_map;
     hlt::Position drop_position; // Dropoff ou shipyard le plus proche
     int turns_remaining;
+    ShipIntent *intent; // Ecritures differees vers le blackboard
     MoveRequest result_move_request;
   };
 
-  class ShipFSM
+  /// Etats du FSM des ships, index dans le graphe statique
+  enum class ShipState : uint8_t
   {
-  private:
-    hlt::EntityId m_ship_id;
-
-    FSM *m_fsm;
-
-    // STATES
-    FSM_STATE *m_state_explore;
-    FSM_STATE *m_state_collect;
-    FSM_STATE *m_state_return;
-    FSM_STATE *m_state_urgent_return;
-    FSM_STATE *m_state_flee;
-    FSM_STATE *m_state_hunt;
-
-    // TRANSITIONS
-    FSM_TRANSITION *m_trans_explore_to_return;
-    FSM_TRANSITION *m_trans_explore_to_close_return;
-    FSM_TRANSITION *m_trans_explore_to_collect;
-    FSM_TRANSITION *m_trans_explore_to_urgent;
-    FSM_TRANSITION *m_trans_explore_to_hunt;
-    FSM_TRANSITION *m_trans_explore_to_flee;
-
-    FSM_TRANSITION *m_trans_collect_to_return;
-    FSM_TRANSITION *m_trans_collect_to_close_return;
-    FSM_TRANSITION *m_trans_collect_to_explore;
-    FSM_TRANSITION *m_trans_collect_to_urgent;
-    FSM_TRANSITION *m_trans_collect_to_hunt;
-    FSM_TRANSITION *m_trans_collect_to_flee;
-
-    FSM_TRANSITION *m_trans_return_to_explore;
-    FSM_TRANSITION *m_trans_return_to_urgent;
+    EXPLORE,
+    COLLECT,
+    RETURN,
+    URGENT_RETURN,
+    FLEE,
+    HUNT,
+    COUNT
+  };
 
-    FSM_TRANSITION *m_trans_flee_to_explore;
-    FSM_TRANSITION *m_trans_flee_to_urgent;
+  /// Conditions de transition, testees par ShipFSM::evaluate_transitions
+  enum class ShipCondition : uint8_t
+  {
+    IS_FULL,
+    CLOSE_AND_LOADED,
+    CELL_HAS_HALITE,
+    CELL_EMPTY,
+    AT_SHIPYARD,
+    URGENT_RETURN,
+    SHOULD_HUNT,
+    SHOULD_FLEE,
+    NO_HUNT_TARGET,
+    NO_THREAT
+  };
 
-    FSM_TRANSITION *m_trans_hunt_to_explore;
-    FSM_TRANSITION *m_trans_hunt_to_urgent;
-    FSM_TRANSITION *m_trans_hunt_to_flee;
+  class ShipTable;
 
-    // TRANSITION CALLBACKS
-    static float transition_is_full(void *data);
-    static float transition_close_and_loaded(void *data);
-    static float transition_cell_has_halite(void *data);
-    static float transition_cell_empty(void *data);
-    static float transition_at_shipyard(void *data);
-    static float transition_urgent_return(void *data);
-    static float transition_always(void *data);
-    static float transition_should_hunt(void *data);
-    static float transition_should_flee(void *data);
-    static float transition_no_hunt_target(void *data);
-    static float transition_no_threat(void *data);
+  /// FSM d'un ship : seulement son etat courant, le graphe est une table statique commune
+  class ShipFSM
+  {
+  private:
+    hlt::EntityId m_ship_id;
+    ShipState m_state;
 
-    // BEHAVIOR CALLBACKS
-    static void behavior_explore(void *data);
-    static void behavior_collect(void *data);
-    static void behavior_return(void *data);
-    static void behavior_urgent_return(void *data);
-    static void behavior_flee(void *data);
-    static void behavior_hunt(void *data);
+    /// Behavior d'un etat, remplit ctx.result_move_request
+    static void run_behavior(ShipState state, ShipFSMContext &ctx);
 
   public:
-    explicit ShipFSM(hlt::EntityId ship_id);
-    ~ShipFSM();
+    explicit ShipFSM(hlt::EntityId ship_id) : m_ship_id(ship_id), m_state(ShipState::EXPLORE) {}
+
+    /// Evalue les transitions de tous les ships de la table, groupe d'etat par groupe d'etat.
+    /// Remplit table.next_states, a reporter dans chaque FSM avec set_state
+    static void evaluate_transitions(ShipTable &table, const Blackboard &bb, int turns_remaining);
 
-    MoveRequest update(std::shared_ptr<hlt::Ship> ship,
+    /// Execute le behavior du state courant
+    MoveRequest behave(const hlt::Ship &ship,
                         hlt::GameMap &game_map, const hlt::Position &depot_position,
-                        int turns_remaining);
+                        int turns_remaining, const Blackboard &bb, const ShipFeatures &features,
+                        ShipIntent &intent);
 
     hlt::EntityId get_ship_id() const { return m_ship_id; }
+    ShipState get_state() const { return m_state; }
+    void set_state(ShipState state) { m_state = state; }
   };
-} // namespace bot
\ No newline at end of file
+} // namespace bot
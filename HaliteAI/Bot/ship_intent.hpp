@@ -0,0 +1,50 @@
+#pragma once
+
+#include "hlt/types.hpp"
+#include "hlt/position.hpp"
+
+#include <cstdint>
+
+namespace bot
+{
+    /// Intentions d'un ship produites pendant la phase de decision.
+    /// Les states lisent le Blackboard en lecture seule et ecrivent ici,
+    /// le merge dans le Blackboard se fait apres, dans l'ordre des ship ids.
+    struct ShipIntent
+    {
+        hlt::EntityId ship_id = -1;
+
+        // Target persistant (explore)
+        bool drop_persistent_target = false;
+        bool has_persistent_target = false;
+        hlt::Position persistent_target{-1, -1};
+
+        // Cell revendiquee ce tour
+        bool has_claimed_cell = false;
+        hlt::Position claimed_cell{-1, -1};
+        uint32_t claim_priority = 0; // Score du ship sur la cell, un score plus haut vole la claim
+
+        // Cible de chasse
+        bool drop_hunt_target = false;
+        hlt::EntityId hunt_target = -1;
+
+        void reset(hlt::EntityId id)
+        {
+            *this = ShipIntent{};
+            ship_id = id;
+        }
+
+        void set_persistent_target(const hlt::Position &pos)
+        {
+            has_persistent_target = true;
+            persistent_target = pos;
+        }
+
+        void claim_cell(const hlt::Position &pos, uint32_t priority)
+        {
+            has_claimed_cell = true;
+            claimed_cell = pos;
+            claim_priority = priority;
+        }
+    };
+} // namespace bot
@@ -0,0 +1,51 @@
+#include "ship_slots.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    constexpr uint32_t ShipSlots::NO_SLOT;
+
+    uint32_t ShipSlots::acquire(hlt::EntityId ship_id, bool &created)
+    {
+        created = false;
+        if (ship_id < 0)
+            return NO_SLOT;
+
+        size_t id = static_cast<size_t>(ship_id);
+        if (id >= m_slot_of_id.size())
+            m_slot_of_id.resize(std::max(id + 1, m_slot_of_id.size() * 2), NO_SLOT);
+
+        uint32_t &slot = m_slot_of_id[id];
+        if (slot != NO_SLOT)
+            return slot;
+
+        if (!m_free_slots.empty())
+        {
+            slot = m_free_slots.back();
+            m_free_slots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_ids.size());
+            m_ids.push_back(-1);
+            // Place pour liberer tous les slots : release n'alloue jamais
+            m_free_slots.reserve(m_ids.capacity());
+        }
+
+        m_ids[slot] = ship_id;
+        created = true;
+        return slot;
+    }
+
+    void ShipSlots::release(hlt::EntityId ship_id)
+    {
+        uint32_t slot = slot_of(ship_id);
+        if (slot == NO_SLOT)
+            return;
+
+        m_slot_of_id[ship_id] = NO_SLOT;
+        m_ids[slot] = -1;
+        m_free_slots.push_back(slot);
+    }
+} // namespace bot
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "hlt/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    /// Slot map de nos ships : chaque ship vivant a un index dense, recycle
+    /// a sa mort. L'etat par ship vit dans des colonnes paralleles indexees par slot, dimensionnees
+    /// a capacity(). Lookup id -> slot en O(1), pas d'allocation une fois la flotte max atteinte
+    /// Un slot n'est garde que le temps d'un tour : les references durables passent par l'id
+    class ShipSlots
+    {
+    public:
+        static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+        /// Slot du ship, pris dans les slots libres ou ajoute s'il n'en a pas.
+        /// created vaut true si le slot vient d'etre attribue : ses colonnes sont a reinitialiser
+        uint32_t acquire(hlt::EntityId ship_id, bool &created);
+
+        /// Libere le slot du ship, il pourra etre reattribue a un nouveau ship
+        void release(hlt::EntityId ship_id);
+
+        /// Slot du ship, NO_SLOT s'il n'en a pas
+        uint32_t slot_of(hlt::EntityId ship_id) const
+        {
+            if (ship_id < 0 || static_cast<size_t>(ship_id) >= m_slot_of_id.size())
+                return NO_SLOT;
+            return m_slot_of_id[ship_id];
+        }
+
+        /// Ship du slot, -1 si le slot est libre
+        hlt::EntityId id_at(uint32_t slot) const { return m_ids[slot]; }
+
+        /// Slots alloues, libres compris : taille des colonnes
+        size_t capacity() const { return m_ids.size(); }
+
+        /// Slots occupes
+        size_t size() const { return m_ids.size() - m_free_slots.size(); }
+
+    private:
+        std::vector<uint32_t> m_slot_of_id;  // Id -> slot, NO_SLOT si aucun
+        std::vector<hlt::EntityId> m_ids;    // Slot -> id, -1 si libre
+        std::vector<uint32_t> m_free_slots;
+    };
+} // namespace bot
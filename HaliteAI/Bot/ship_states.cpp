@@ -2,48 +2,53 @@
 #include "blackboard.hpp"
 #include "map_utils.hpp"
 #include "bot_constants.hpp"
+#include "turn_arena.hpp"
 #include "hlt/game_map.hpp"
 #include "hlt/direction.hpp"
 #include "hlt/constants.hpp"
 
 #include <algorithm>
+#include <array>
 #include <vector>
 #include <utility>
 
 namespace bot
 {
     // BASE
-    MoveRequest ShipStateType::execute(std::shared_ptr<hlt::Ship> ship,
-                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipStateType::execute(const hlt::Ship &ship,
+                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
-        std::vector<hlt::Direction> alternatives(hlt::ALL_CARDINALS.begin(), hlt::ALL_CARDINALS.end());
-        return MoveRequest{ship->id, ship->position, ship->position,
-                           hlt::Direction::STILL, constants::COLLECT_PRIORITY, alternatives};
+        DirectionList alternatives = DirectionList::cardinals();
+        return MoveRequest{ship.id, ship.position, ship.position,
+                           hlt::Direction::STILL, bb.params.collect_priority, alternatives};
     }
 
     // Navigation helper avec blackboard (danger zones + stuck)
-    static void navigate_with_blackboard(std::shared_ptr<hlt::Ship> ship,
+    static void navigate_with_blackboard(const Blackboard &bb,
+                                         const hlt::Ship &ship,
                                          hlt::GameMap &game_map,
                                          const hlt::Position &destination,
                                          hlt::Direction &out_best_dir,
-                                         std::vector<hlt::Direction> &out_alternatives,
+                                         DirectionList &out_alternatives,
                                          bool is_returning = false)
     {
-        const Blackboard &bb = Blackboard::get_instance();
         map_utils::navigate_toward(ship, game_map, destination,
                                    bb.stuck_positions, bb.danger_zones,
+                                   bb.enemy_moves, bb.params.danger_occupancy,
                                    out_best_dir, out_alternatives, is_returning);
 
         // Ship oscille -> forcer une alternative
-        if (bb.is_ship_oscillating(ship->id) && !out_alternatives.empty())
+        if (bb.is_ship_oscillating(ship.id) && !out_alternatives.empty())
         {
             // Chercher une alternative safe
             for (size_t i = 0; i < out_alternatives.size(); ++i)
             {
                 hlt::Position alt_pos = game_map.normalize(
-                    ship->position.directional_offset(out_alternatives[i]));
-                bool safe = bb.danger_zones.find(alt_pos) == bb.danger_zones.end();
-                bool not_stuck = bb.stuck_positions.find(alt_pos) == bb.stuck_positions.end();
+                    ship.position.directional_offset(out_alternatives[i]));
+                bool safe = bb.is_position_safe(alt_pos);
+                bool not_stuck = !bb.stuck_positions.contains(alt_pos);
 
                 if (safe && not_stuck)
                 {
@@ -57,36 +62,42 @@ namespace bot
         }
     }
 
-    // Trier les directions alternatives par halite decroissant
-    static std::vector<hlt::Direction> rank_adjacent_directions(
-        std::shared_ptr<hlt::Ship> ship, hlt::GameMap &game_map, hlt::Direction exclude)
+    // Trier les directions alternatives par halite decroissant, score = halite de la cell
+    static DirectionList rank_adjacent_directions(
+        const hlt::Ship &ship, hlt::GameMap &game_map, hlt::Direction exclude)
     {
-        std::vector<std::pair<int, hlt::Direction>> scored;
+        std::array<std::pair<int, hlt::Direction>, 4> scored;
+        size_t count = 0;
         for (const auto &dir : hlt::ALL_CARDINALS)
         {
             if (dir == exclude) continue;
-            hlt::Position pos = ship->position.directional_offset(dir);
-            scored.push_back({game_map.at(pos)->halite, dir});
+            hlt::Position pos = ship.position.directional_offset(dir);
+            std::pair<int, hlt::Direction> entry{game_map.at(pos)->halite, dir};
+
+            // Insertion stable, a egalite l'ordre de ALL_CARDINALS est garde
+            size_t i = count++;
+            for (; i > 0 && scored[i - 1].first < entry.first; --i)
+                scored[i] = scored[i - 1];
+            scored[i] = entry;
         }
-        std::sort(scored.begin(), scored.end(),
-                  [](const auto &a, const auto &b) { return a.first > b.first; });
 
-        std::vector<hlt::Direction> result;
-        for (const auto &s : scored)
-            result.push_back(s.second);
+        DirectionList result;
+        for (size_t i = 0; i < count; ++i)
+            result.push_back(scored[i].second, scored[i].first);
         return result;
     }
 
     // Fallback explore : meilleure case adjacente
-    static MoveRequest explore_best_adjacent(std::shared_ptr<hlt::Ship> ship, hlt::GameMap &game_map)
+    static MoveRequest explore_best_adjacent(const Blackboard &bb, const hlt::Ship &ship,
+                                             hlt::GameMap &game_map)
     {
         int max_halite = -1;
         hlt::Direction best_direction = hlt::Direction::STILL;
-        hlt::Position best_adj = ship->position;
+        hlt::Position best_adj = ship.position;
 
         for (const auto &direction : hlt::ALL_CARDINALS)
         {
-            hlt::Position target_pos = ship->position.directional_offset(direction);
+            hlt::Position target_pos = ship.position.directional_offset(direction);
             int cell_halite = game_map.at(target_pos)->halite;
             if (cell_halite > max_halite)
             {
@@ -96,170 +107,161 @@ namespace bot
             }
         }
 
-        if (best_adj == ship->position)
+        if (best_adj == ship.position)
         {
-            std::vector<hlt::Direction> alternatives(hlt::ALL_CARDINALS.begin(), hlt::ALL_CARDINALS.end());
-            return MoveRequest{ship->id, ship->position, ship->position,
-                               hlt::Direction::STILL, constants::EXPLORE_PRIORITY, alternatives};
+            DirectionList alternatives = DirectionList::cardinals();
+            return MoveRequest{ship.id, ship.position, ship.position,
+                               hlt::Direction::STILL, bb.params.explore_priority, alternatives};
         }
 
         auto alternatives = rank_adjacent_directions(ship, game_map, best_direction);
-        return MoveRequest{ship->id, ship->position, best_adj,
-                           best_direction, constants::EXPLORE_PRIORITY, alternatives};
+        return MoveRequest{ship.id, ship.position, best_adj,
+                           best_direction, bb.params.explore_priority, alternatives};
     }
 
     // Collecte les menaces proches d'un ship
-    static std::vector<hlt::Position> collect_nearby_threats(
-        const Blackboard &bb, std::shared_ptr<hlt::Ship> ship, hlt::GameMap &game_map)
+    static ArenaVector<hlt::Position> collect_nearby_threats(
+        const Blackboard &bb, const hlt::Ship &ship)
     {
-        std::vector<hlt::Position> threats;
-        for (const auto &enemy : bb.enemy_ships)
-        {
-            if (enemy.halite < ship->halite)
-            {
-                int dist = game_map.calculate_distance(ship->position, enemy.position);
-                if (dist <= constants::FLEE_THREAT_RADIUS + 1)
-                    threats.push_back(enemy.position);
-            }
-        }
+        ArenaVector<hlt::Position> threats;
+        int ship_halite = ship.halite;
+        bb.enemy_index.for_each_within(ship.position, bb.params.flee_threat_radius + 1,
+                                       [&](const EnemyShipInfo &enemy, size_t, int)
+                                       {
+                                           if (enemy.halite < ship_halite)
+                                               threats.push_back(enemy.position);
+                                       });
         return threats;
     }
 
     // EXPLORE
-    MoveRequest ShipExploreState::execute(std::shared_ptr<hlt::Ship> ship,
-                                          hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipExploreState::execute(const hlt::Ship &ship,
+                                          hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
-        Blackboard &bb = Blackboard::get_instance();
-
-        // Ship oscille -> drop son target persistant
-        if (bb.is_ship_oscillating(ship->id))
+        // Ship oscille ou n'avance plus -> drop son target persistant
+        bool oscillating = bb.is_ship_oscillating(ship.id) || bb.is_ship_stalled(ship.id);
+        if (oscillating)
         {
-            bb.persistent_targets.erase(ship->id);
+            intent.drop_persistent_target = true;
         }
 
         // Target persistant existant ?
-        auto pt_it = bb.persistent_targets.find(ship->id);
-        if (pt_it != bb.persistent_targets.end())
+        const hlt::Position *persistent_target = bb.find_persistent_target(ship.id);
+        if (!oscillating && persistent_target != nullptr)
         {
-            hlt::Position target = pt_it->second;
-            int dist = game_map.calculate_distance(ship->position, target);
+            hlt::Position target = *persistent_target;
+            int dist = game_map.calculate_distance(ship.position, target);
 
             // Arrive ou zone pauvre -> drop
-            if (dist == 0 || game_map.at(target)->halite < constants::TARGET_MIN_HALITE)
+            if (dist == 0 || game_map.at(target)->halite < bb.params.target_min_halite)
             {
-                bb.persistent_targets.erase(pt_it);
+                intent.drop_persistent_target = true;
             }
             else
             {
                 // Continuer vers le meme target
-                bb.targeted_cells[target] = ship->id;
+                intent.claim_cell(target, CellClaims::PERSISTENT_PRIORITY);
 
                 hlt::Direction best_dir;
-                std::vector<hlt::Direction> alternatives;
-                navigate_with_blackboard(ship, game_map, target, best_dir, alternatives);
+                DirectionList alternatives;
+                navigate_with_blackboard(bb, ship, game_map, target, best_dir, alternatives);
 
-                hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-                return MoveRequest{ship->id, ship->position, desired,
-                                   best_dir, constants::EXPLORE_PRIORITY, alternatives};
+                hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+                return MoveRequest{ship.id, ship.position, desired,
+                                   best_dir, bb.params.explore_priority, alternatives};
             }
         }
 
         // Cherche target via HPT (halite net / temps total)
-        hlt::Position target = bb.find_best_explore_target(game_map, ship->position, ship->id, ship->halite, bb.drop_positions);
+        int target_score = 0;
+        hlt::Position target = bb.find_best_explore_target(game_map, ship.position, ship.id, ship.halite,
+                                                           bb.drop_positions, target_score);
 
-        if (target != ship->position)
+        if (target != ship.position)
         {
-            // Persister le target
-            bb.persistent_targets[ship->id] = target;
-            bb.targeted_cells[target] = ship->id;
+            // Persister le target, le score sert de priorite de claim
+            uint32_t priority = static_cast<uint32_t>(std::min<int>(std::max(target_score, 0),
+                                                                    CellClaims::PERSISTENT_PRIORITY - 1));
+            intent.set_persistent_target(target);
+            intent.claim_cell(target, priority);
 
             hlt::Direction best_dir;
-            std::vector<hlt::Direction> alternatives;
-            navigate_with_blackboard(ship, game_map, target, best_dir, alternatives);
+            DirectionList alternatives;
+            navigate_with_blackboard(bb, ship, game_map, target, best_dir, alternatives);
 
-            hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-            return MoveRequest{ship->id, ship->position, desired,
-                               best_dir, constants::EXPLORE_PRIORITY, alternatives};
+            hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+            return MoveRequest{ship.id, ship.position, desired,
+                               best_dir, bb.params.explore_priority, alternatives};
         }
 
         // Fallback : meilleure case adjacente
-        return explore_best_adjacent(ship, game_map);
+        return explore_best_adjacent(bb, ship, game_map);
     }
 
     // COLLECT : gain marginal vs rendement moyen par tour
-    MoveRequest ShipCollectState::execute(std::shared_ptr<hlt::Ship> ship,
-                                          hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipCollectState::execute(const hlt::Ship &ship,
+                                          hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
-        const Blackboard &bb = Blackboard::get_instance();
-
-        int cell_halite = game_map.at(ship->position)->halite;
-        bool inspired = bb.inspired_zones.find(game_map.normalize(ship->position)) != bb.inspired_zones.end();
-        int extract_ratio = inspired ? hlt::constants::INSPIRED_EXTRACT_RATIO : hlt::constants::EXTRACT_RATIO;
-
-        // Extraction marginale ce tour
-        int marginal_extract = cell_halite / extract_ratio;
-        if (inspired)
-            marginal_extract += static_cast<int>(marginal_extract * hlt::constants::INSPIRED_BONUS_MULTIPLIER);
-
-        // Rendement moyen par tour d'un trip (~6 tours)
-        int avg_trip_halite = bb.average_halite > 0 ? bb.average_halite : 1;
-        int est_trip_turns = 6;
-        int avg_yield_per_turn = avg_trip_halite / est_trip_turns;
-
-        // Marginal < rendement moyen -> partir
-        bool should_leave = marginal_extract < avg_yield_per_turn;
+        // Extraction marginale ce tour < rendement moyen par tour d'un trip -> partir
+        bool should_leave = features.marginal_yield < features.average_yield;
 
         if (should_leave)
         {
             // Cell epuisee, retour au drop
             hlt::Direction best_dir;
-            std::vector<hlt::Direction> alternatives;
-            navigate_with_blackboard(ship, game_map, shipyard_position, best_dir, alternatives);
+            DirectionList alternatives;
+            navigate_with_blackboard(bb, ship, game_map, shipyard_position, best_dir, alternatives);
 
-            hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-            return MoveRequest{ship->id, ship->position, desired,
-                               best_dir, constants::COLLECT_PRIORITY, alternatives};
+            hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+            return MoveRequest{ship.id, ship.position, desired,
+                               best_dir, bb.params.collect_priority, alternatives};
         }
 
         // Cell encore rentable, on reste
         auto alternatives = rank_adjacent_directions(ship, game_map, hlt::Direction::STILL);
-        return MoveRequest{ship->id, ship->position, ship->position,
-                           hlt::Direction::STILL, constants::COLLECT_PRIORITY, alternatives};
+        return MoveRequest{ship.id, ship.position, ship.position,
+                           hlt::Direction::STILL, bb.params.collect_priority, alternatives};
     }
 
     // RETURN
-    MoveRequest ShipReturnState::execute(std::shared_ptr<hlt::Ship> ship,
-                                         hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipReturnState::execute(const hlt::Ship &ship,
+                                         hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
         hlt::Direction best_dir;
-        std::vector<hlt::Direction> alternatives;
+        DirectionList alternatives;
         // Penaliser le burn en return
-        navigate_with_blackboard(ship, game_map, shipyard_position, best_dir, alternatives, true);
+        navigate_with_blackboard(bb, ship, game_map, shipyard_position, best_dir, alternatives, true);
 
-        hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-        return MoveRequest{ship->id, ship->position, desired,
-                           best_dir, constants::RETURN_PRIORITY, alternatives};
+        hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+        return MoveRequest{ship.id, ship.position, desired,
+                           best_dir, bb.params.return_priority, alternatives};
     }
 
     // FLEE : maximise distance aux menaces tout en rentrant
-    MoveRequest ShipFleeState::execute(std::shared_ptr<hlt::Ship> ship,
-                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipFleeState::execute(const hlt::Ship &ship,
+                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
-        const Blackboard &bb = Blackboard::get_instance();
-
-        std::vector<hlt::Position> threats = collect_nearby_threats(bb, ship, game_map);
-
         // Plus de menace, retour normal
-        if (threats.empty())
+        if (bb.threat_field.threat_arrival(ship.position, ship.halite) > bb.params.flee_threat_radius + 1)
         {
             hlt::Direction best_dir;
-            std::vector<hlt::Direction> alternatives;
-            navigate_with_blackboard(ship, game_map, shipyard_position, best_dir, alternatives);
-            hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-            return MoveRequest{ship->id, ship->position, desired,
-                               best_dir, constants::FLEE_PRIORITY, alternatives};
+            DirectionList alternatives;
+            navigate_with_blackboard(bb, ship, game_map, shipyard_position, best_dir, alternatives);
+            hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+            return MoveRequest{ship.id, ship.position, desired,
+                               best_dir, bb.params.flee_priority, alternatives};
         }
 
+        ArenaVector<hlt::Position> threats = collect_nearby_threats(bb, ship);
+
         // Scorer chaque direction
         struct ScoredMove
         {
@@ -267,35 +269,38 @@ namespace bot
             int safety;    // Somme des distances aux menaces
             int to_drop;   // Distance au drop
             int cell_cost; // Cout de deplacement sur cette cell
+            bool in_danger;
         };
 
-        std::vector<ScoredMove> moves;
+        ArenaVector<ScoredMove> moves;
 
         // rester sur place
         {
             int safety = 0;
             for (const auto &t : threats)
-                safety += game_map.calculate_distance(ship->position, t);
+                safety += game_map.calculate_distance(ship.position, t);
             moves.push_back({hlt::Direction::STILL, safety,
-                             game_map.calculate_distance(ship->position, shipyard_position), 0});
+                             game_map.calculate_distance(ship.position, shipyard_position), 0, false});
         }
 
         for (const auto &dir : hlt::ALL_CARDINALS)
         {
-            hlt::Position target = game_map.normalize(ship->position.directional_offset(dir));
+            hlt::Position target = game_map.normalize(ship.position.directional_offset(dir));
 
             int safety = 0;
             for (const auto &t : threats)
                 safety += game_map.calculate_distance(target, t);
 
-            bool in_danger = bb.danger_zones.find(target) != bb.danger_zones.end();
+            // Enemy sur la cell, ou enemy plus leger qui peut y entrer au prochain tour
+            bool in_danger = bb.danger_zones.contains(target) ||
+                             bb.threat_field.threat_arrival(target, ship.halite) <= 1;
             if (in_danger)
                 safety -= 100; // Grosse penalite si on fonce dans un ennemi
 
             int to_drop = game_map.calculate_distance(target, shipyard_position);
             int cell_cost = game_map.at(target)->halite / hlt::constants::MOVE_COST_RATIO;
 
-            moves.push_back({dir, safety, to_drop, cell_cost});
+            moves.push_back({dir, safety, to_drop, cell_cost, in_danger});
         }
 
         // Tri : safety desc, dist au drop asc
@@ -308,56 +313,63 @@ namespace bot
                   });
 
         hlt::Direction best_dir = moves[0].dir;
-        std::vector<hlt::Direction> alternatives;
+        // Score : safety puis distance au drop, l'ordre du tri fait foi
+        DirectionList alternatives;
         for (size_t i = 1; i < moves.size(); ++i)
-            if (moves[i].dir != hlt::Direction::STILL)
-                alternatives.push_back(moves[i].dir);
+        {
+            if (moves[i].dir == hlt::Direction::STILL)
+                continue;
+            int score = moves[i].safety * 256 - moves[i].to_drop;
+            if (moves[i].in_danger)
+                score += constants::MOVE_SCORE_UNSAFE;
+            alternatives.push_back(moves[i].dir, score);
+        }
 
-        hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-        return MoveRequest{ship->id, ship->position, desired,
-                           best_dir, constants::FLEE_PRIORITY, alternatives};
+        hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+        return MoveRequest{ship.id, ship.position, desired,
+                           best_dir, bb.params.flee_priority, alternatives};
     }
 
     // HUNT : chasser un ennemi charge
-    MoveRequest ShipHuntState::execute(std::shared_ptr<hlt::Ship> ship,
-                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipHuntState::execute(const hlt::Ship &ship,
+                                       hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
-        Blackboard &bb = Blackboard::get_instance();
-
-        hlt::Position target = bb.find_hunt_target(game_map, ship->position, ship->id);
+        hlt::Position target = bb.find_hunt_target(game_map, ship.position, ship.id, intent);
 
         // Pas de target -> fallback explore
         if (target.x < 0)
         {
-            return ShipExploreState::execute(ship, game_map, shipyard_position);
+            return ShipExploreState::execute(ship, game_map, shipyard_position, bb, features, intent);
         }
 
-        // Danger zones sans la target
-        std::set<hlt::Position> hunt_dangers = bb.danger_zones;
-        hunt_dangers.erase(target);
-
         hlt::Direction best_dir;
-        std::vector<hlt::Direction> alternatives;
+        DirectionList alternatives;
+        // Danger zones sans la target
         map_utils::navigate_toward(ship, game_map, target,
-                                   bb.stuck_positions, hunt_dangers,
-                                   best_dir, alternatives);
+                                   bb.stuck_positions, bb.danger_zones,
+                                   bb.enemy_moves, bb.params.danger_occupancy,
+                                   best_dir, alternatives, false, target);
 
-        hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-        return MoveRequest{ship->id, ship->position, desired,
-                           best_dir, constants::HUNT_PRIORITY, alternatives};
+        hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+        return MoveRequest{ship.id, ship.position, desired,
+                           best_dir, bb.params.hunt_priority, alternatives};
     }
 
     // URGENT RETURN
-    MoveRequest ShipUrgentReturnState::execute(std::shared_ptr<hlt::Ship> ship,
-                                               hlt::GameMap &game_map, const hlt::Position &shipyard_position)
+    MoveRequest ShipUrgentReturnState::execute(const hlt::Ship &ship,
+                                               hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                       const Blackboard &bb, const ShipFeatures &features,
+                                       ShipIntent &intent)
     {
         hlt::Direction best_dir;
-        std::vector<hlt::Direction> alternatives;
+        DirectionList alternatives;
         // Penaliser le burn en return
-        navigate_with_blackboard(ship, game_map, shipyard_position, best_dir, alternatives, true);
+        navigate_with_blackboard(bb, ship, game_map, shipyard_position, best_dir, alternatives, true);
 
-        hlt::Position desired = game_map.normalize(ship->position.directional_offset(best_dir));
-        return MoveRequest{ship->id, ship->position, desired,
-                           best_dir, constants::URGENT_RETURN_PRIORITY, alternatives};
+        hlt::Position desired = game_map.normalize(ship.position.directional_offset(best_dir));
+        return MoveRequest{ship.id, ship.position, desired,
+                           best_dir, bb.params.urgent_return_priority, alternatives};
     }
 } // namespace bot
\ No newline at end of file
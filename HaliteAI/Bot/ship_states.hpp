@@ -1,59 +1,75 @@
 #pragma once
 
 #include "move_request.hpp"
+#include "ship_intent.hpp"
+#include "ship_features.hpp"
 #include "hlt/game_map.hpp"
 #include "hlt/ship.hpp"
 
-#include <memory>
-
 namespace bot
 {
+    struct Blackboard;
+
     class ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipExploreState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipCollectState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipReturnState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipFleeState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipHuntState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 
     class ShipUrgentReturnState : public ShipStateType
     {
     public:
-        static MoveRequest execute(std::shared_ptr<hlt::Ship> ship,
-                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position);
+        static MoveRequest execute(const hlt::Ship &ship,
+                                    hlt::GameMap &game_map, const hlt::Position &shipyard_position,
+                                    const Blackboard &bb, const ShipFeatures &features,
+                                    ShipIntent &intent);
     };
 } // namespace bot
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "ship_table.hpp"
+
+namespace bot
+{
+    void ShipTable::reset(const std::array<size_t, SHIP_STATE_COUNT> &state_counts)
+    {
+        group_offsets[0] = 0;
+        for (size_t s = 0; s < SHIP_STATE_COUNT; ++s)
+        {
+            group_offsets[s + 1] = group_offsets[s] + state_counts[s];
+            m_cursors[s] = group_offsets[s];
+        }
+
+        size_t count = group_offsets[SHIP_STATE_COUNT];
+        ids.resize(count);
+        decisions.resize(count);
+        cells.resize(count);
+        cargo.resize(count);
+        states.resize(count);
+        next_states.resize(count);
+        best_scores.resize(count);
+        depot_distance.resize(count);
+        marginal_yield.resize(count);
+        threatened.resize(count);
+        can_hunt.resize(count);
+        hunt_target_valid.resize(count);
+    }
+
+    size_t ShipTable::insert(ShipState state, hlt::EntityId id, uint32_t decision, int cell, int cargo_halite)
+    {
+        size_t row = m_cursors[static_cast<size_t>(state)]++;
+
+        ids[row] = id;
+        decisions[row] = decision;
+        cells[row] = cell;
+        cargo[row] = cargo_halite;
+        states[row] = state;
+        next_states[row] = state;
+        best_scores[row] = 0.f;
+
+        return row;
+    }
+
+    void ShipTable::set_features(size_t row, const ShipFeatures &features)
+    {
+        depot_distance[row] = features.depot_distance;
+        marginal_yield[row] = features.marginal_yield;
+        threatened[row] = features.threatened ? 1 : 0;
+        can_hunt[row] = features.can_hunt ? 1 : 0;
+        hunt_target_valid[row] = features.hunt_target_valid ? 1 : 0;
+    }
+} // namespace bot
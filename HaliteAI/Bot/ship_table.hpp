@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ship_fsm.hpp"
+#include "ship_features.hpp"
+#include "hlt/types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    constexpr size_t SHIP_STATE_COUNT = static_cast<size_t>(ShipState::COUNT);
+
+    /// Ships normaux du tour en structure de tableaux. Les lignes sont groupees par etat
+    /// du FSM : l'etat s occupe [group_offsets[s], group_offsets[s + 1]), dans l'ordre d'insertion.
+    /// Les colonnes gardent leur capacite d'un tour a l'autre
+    class ShipTable
+    {
+    public:
+        // Colonnes
+        std::vector<hlt::EntityId> ids;
+        std::vector<uint32_t> decisions;     // Index de la decision du ship dans BotPlayer
+        std::vector<int> cells;              // y * width + x
+        std::vector<int> cargo;
+        std::vector<ShipState> states;       // Etat au debut du tour
+        std::vector<ShipState> next_states;  // Etat apres evaluation des transitions
+        std::vector<float> best_scores;      // Score de la transition retenue, 0 si aucune
+        std::vector<int> depot_distance;
+        std::vector<int> marginal_yield;
+        std::vector<uint8_t> threatened;
+        std::vector<uint8_t> can_hunt;
+        std::vector<uint8_t> hunt_target_valid;
+
+        size_t group_offsets[SHIP_STATE_COUNT + 1] = {};
+
+        /// Dimensionne les colonnes pour state_counts[s] ships dans chaque etat
+        void reset(const std::array<size_t, SHIP_STATE_COUNT> &state_counts);
+
+        /// Ligne suivante du groupe de state, remplie avec les infos du ship
+        size_t insert(ShipState state, hlt::EntityId id, uint32_t decision, int cell, int cargo_halite);
+
+        /// Copie les features utiles aux transitions dans les colonnes
+        void set_features(size_t row, const ShipFeatures &features);
+
+        size_t size() const { return ids.size(); }
+
+    private:
+        size_t m_cursors[SHIP_STATE_COUNT] = {};
+    };
+} // namespace bot
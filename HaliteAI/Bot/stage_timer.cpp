@@ -0,0 +1,114 @@
+#include "stage_timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace bot
+{
+    const char *stage_name(Stage stage)
+    {
+        switch (stage)
+        {
+        case Stage::PLAY_TURN:           return "play_turn";
+        case Stage::UPDATE_BLACKBOARD:   return "update_blackboard";
+        case Stage::MAP_STATS:           return "  map_stats";
+        case Stage::HEATMAP:             return "  heatmap";
+        case Stage::ENEMY_INFO:          return "  enemy_info";
+        case Stage::INSPIRATION:         return "  inspiration";
+        case Stage::DROPOFF:             return "dropoff";
+        case Stage::COLLECT_MOVES:       return "collect_move_requests";
+        case Stage::STATE_EXPLORE:       return "  state_explore";
+        case Stage::STATE_COLLECT:       return "  state_collect";
+        case Stage::STATE_RETURN:        return "  state_return";
+        case Stage::STATE_URGENT_RETURN: return "  state_urgent_return";
+        case Stage::STATE_FLEE:          return "  state_flee";
+        case Stage::STATE_HUNT:          return "  state_hunt";
+        case Stage::TRAFFIC:             return "resolve_all";
+        case Stage::COUNT:               break;
+        }
+        return "?";
+    }
+
+    LatencyHistogram::LatencyHistogram() : m_count(0), m_total_ns(0), m_max_ns(0)
+    {
+        for (auto &bucket : m_buckets)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    // < 16 ns : un bucket par ns, sinon 8 sous-buckets par puissance de 2
+    size_t LatencyHistogram::bucket_of(uint64_t ns)
+    {
+        if (ns < 16)
+            return static_cast<size_t>(ns);
+
+        int exponent = 0;
+        for (uint64_t v = ns; v > 1; v >>= 1)
+            ++exponent;
+        if (exponent > 40)
+            return BUCKET_COUNT - 1;
+
+        size_t sub = static_cast<size_t>((ns >> (exponent - 3)) & 7);
+        return 16 + static_cast<size_t>(exponent - 4) * 8 + sub;
+    }
+
+    uint64_t LatencyHistogram::bucket_mid(size_t bucket)
+    {
+        if (bucket < 16)
+            return bucket;
+
+        int exponent = static_cast<int>((bucket - 16) / 8) + 4;
+        uint64_t sub = (bucket - 16) % 8;
+        uint64_t width = 1ull << (exponent - 3);
+        return (1ull << exponent) + sub * width + width / 2;
+    }
+
+    void LatencyHistogram::record(uint64_t ns)
+    {
+        m_buckets[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_total_ns.fetch_add(ns, std::memory_order_relaxed);
+
+        uint64_t current = m_max_ns.load(std::memory_order_relaxed);
+        while (ns > current && !m_max_ns.compare_exchange_weak(current, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t LatencyHistogram::percentile_ns(double p) const
+    {
+        uint64_t total = count();
+        if (total == 0)
+            return 0;
+
+        uint64_t rank = static_cast<uint64_t>(p * (total - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; ++b)
+        {
+            seen += m_buckets[b].load(std::memory_order_relaxed);
+            if (seen >= rank)
+                return std::min(bucket_mid(b), max_ns());
+        }
+        return max_ns();
+    }
+
+    std::string StageProfiler::report() const
+    {
+        std::string out = "stage                      count    p50_us    p99_us    max_us  total_ms\n";
+        char line[160];
+
+        for (size_t s = 0; s < static_cast<size_t>(Stage::COUNT); ++s)
+        {
+            const LatencyHistogram &histogram = m_stages[s];
+            if (histogram.count() == 0)
+                continue;
+
+            std::snprintf(line, sizeof(line), "%-24s %8llu %9.1f %9.1f %9.1f %9.1f\n",
+                          stage_name(static_cast<Stage>(s)),
+                          static_cast<unsigned long long>(histogram.count()),
+                          histogram.percentile_ns(0.50) / 1e3, histogram.percentile_ns(0.99) / 1e3,
+                          histogram.max_ns() / 1e3, histogram.total_ns() / 1e6);
+            out += line;
+        }
+        return out;
+    }
+} // namespace bot
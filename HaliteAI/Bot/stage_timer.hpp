@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bot
+{
+    /// Etapes chronometrees du tour
+    enum class Stage
+    {
+        PLAY_TURN,
+        UPDATE_BLACKBOARD,
+        MAP_STATS,
+        HEATMAP,
+        ENEMY_INFO,
+        INSPIRATION,
+        DROPOFF,
+        COLLECT_MOVES,
+        STATE_EXPLORE,
+        STATE_COLLECT,
+        STATE_RETURN,
+        STATE_URGENT_RETURN,
+        STATE_FLEE,
+        STATE_HUNT,
+        TRAFFIC,
+        COUNT
+    };
+
+    const char *stage_name(Stage stage);
+
+    /// Histogramme de durees en ns, buckets log-lineaires (8 par puissance de 2, ~12% d'erreur).
+    /// record() est sans lock : les states des ships tournent sur les workers.
+    class LatencyHistogram
+    {
+    public:
+        static constexpr size_t BUCKET_COUNT = 16 + 37 * 8;
+
+        LatencyHistogram();
+
+        void record(uint64_t ns);
+
+        uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+        uint64_t total_ns() const { return m_total_ns.load(std::memory_order_relaxed); }
+        uint64_t max_ns() const { return m_max_ns.load(std::memory_order_relaxed); }
+
+        /// Duree au percentile p (0..1), milieu du bucket
+        uint64_t percentile_ns(double p) const;
+
+    private:
+        static size_t bucket_of(uint64_t ns);
+        static uint64_t bucket_mid(size_t bucket);
+
+        std::atomic<uint32_t> m_buckets[BUCKET_COUNT];
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_total_ns;
+        std::atomic<uint64_t> m_max_ns;
+    };
+
+    /// Histogrammes de toutes les etapes d'une partie
+    class StageProfiler
+    {
+    public:
+        StageProfiler() = default;
+
+        // Non-copiable
+        StageProfiler(const StageProfiler &) = delete;
+        StageProfiler &operator=(const StageProfiler &) = delete;
+
+        void record(Stage stage, uint64_t ns) { m_stages[static_cast<size_t>(stage)].record(ns); }
+
+        const LatencyHistogram &histogram(Stage stage) const { return m_stages[static_cast<size_t>(stage)]; }
+
+        /// Tableau count / p50 / p99 / max / total par etape (etapes jamais vues omises)
+        std::string report() const;
+
+    private:
+        LatencyHistogram m_stages[static_cast<size_t>(Stage::COUNT)];
+    };
+
+    /// Chronometre une portee et l'ajoute au profiler (ignore si profiler est nul)
+    class ScopedStageTimer
+    {
+    public:
+        ScopedStageTimer(StageProfiler *profiler, Stage stage)
+            : m_profiler(profiler), m_stage(stage), m_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ScopedStageTimer()
+        {
+            if (!m_profiler)
+                return;
+            auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_profiler->record(m_stage, static_cast<uint64_t>(
+                                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+        ScopedStageTimer(const ScopedStageTimer &) = delete;
+        ScopedStageTimer &operator=(const ScopedStageTimer &) = delete;
+
+    private:
+        StageProfiler *m_profiler;
+        Stage m_stage;
+        std::chrono::steady_clock::time_point m_start;
+    };
+} // namespace bot
+
+// Sans BOT_STAGE_TIMERS (option CMake), les timers disparaissent a la compilation
+#ifdef BOT_STAGE_TIMERS
+#define BOT_STAGE_TIMER_CONCAT_(a, b) a##b
+#define BOT_STAGE_TIMER_NAME_(line) BOT_STAGE_TIMER_CONCAT_(stage_timer_, line)
+#define BOT_STAGE_TIMER(profiler, stage) ::bot::ScopedStageTimer BOT_STAGE_TIMER_NAME_(__LINE__)((profiler), (stage))
+#else
+#define BOT_STAGE_TIMER(profiler, stage) ((void)0)
+#endif
@@ -0,0 +1,98 @@
+#include "thread_pool.hpp"
+#include "bot_constants.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    ThreadPool::ThreadPool(size_t worker_count)
+    {
+        m_workers.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i)
+            m_workers.emplace_back(&ThreadPool::worker_loop, this);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+
+        for (auto &worker : m_workers)
+            worker.join();
+    }
+
+    size_t ThreadPool::default_worker_count()
+    {
+        size_t hw = std::thread::hardware_concurrency();
+        if (hw <= 1)
+            return 0;
+
+        // Le thread principal compte comme un worker
+        return std::min(hw - 1, static_cast<size_t>(constants::MAX_DECISION_WORKERS));
+    }
+
+    // Depile les indices jusqu'a epuisement
+    void ThreadPool::run_tasks()
+    {
+        for (size_t i = m_next.fetch_add(1); i < m_count; i = m_next.fetch_add(1))
+            (*m_task)(i);
+    }
+
+    void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)> &task)
+    {
+        if (count == 0)
+            return;
+
+        // Pas de workers ou une seule tache : execution directe
+        if (m_workers.empty() || count == 1)
+        {
+            for (size_t i = 0; i < count; ++i)
+                task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_task = &task;
+            m_count = count;
+            m_next.store(0);
+            m_active = m_workers.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        run_tasks();
+
+        // Attendre que tous les workers aient fini leur part
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]
+                    { return m_active == 0; });
+        m_task = nullptr;
+    }
+
+    void ThreadPool::worker_loop()
+    {
+        uint64_t seen_generation = 0;
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this, seen_generation]
+                            { return m_stop || m_generation != seen_generation; });
+                if (m_stop)
+                    return;
+                seen_generation = m_generation;
+            }
+
+            run_tasks();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_active == 0)
+                m_done.notify_one();
+        }
+    }
+} // namespace bot
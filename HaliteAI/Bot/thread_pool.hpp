@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bot
+{
+    /// Pool de threads fixe pour les boucles paralleles du tour.
+    /// Le thread appelant participe au travail, parallel_for est bloquant.
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(size_t worker_count);
+        ~ThreadPool();
+
+        // Non-copiable
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /// Execute task(i) pour i dans [0, count), repartis sur les workers
+        void parallel_for(size_t count, const std::function<void(size_t)> &task);
+
+        /// Nombre de threads qui executent les taches (appelant compris)
+        size_t concurrency() const { return m_workers.size() + 1; }
+
+        /// Nombre de workers par defaut selon la machine
+        static size_t default_worker_count();
+
+    private:
+        void worker_loop();
+        void run_tasks();
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+
+        const std::function<void(size_t)> *m_task = nullptr;
+        size_t m_count = 0;
+        std::atomic<size_t> m_next{0};
+        size_t m_active = 0;
+        uint64_t m_generation = 0;
+        bool m_stop = false;
+    };
+} // namespace bot
@@ -0,0 +1,87 @@
+#include "threat_field.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    constexpr int ThreatField::UNREACHED;
+    constexpr int ThreatField::NO_CARGO;
+
+    void ThreatField::build(const std::vector<EnemyShipInfo> &enemies, int width, int height, int horizon)
+    {
+        m_width = width;
+        m_height = height;
+        m_horizon = std::max(0, horizon);
+        m_cells = static_cast<size_t>(m_width) * m_height;
+
+        m_arrival.assign(m_cells, UNREACHED);
+        m_min_cargo.assign(m_cells * (m_horizon + 1), NO_CARGO);
+        m_queued.assign(m_cells, 0);
+        m_frontier.clear();
+
+        // Un front tient toujours dans la map : plus de reallocation apres le premier tour
+        m_frontier.reserve(m_cells);
+        m_next.reserve(m_cells);
+
+        // Tour 0 : la cell de chaque enemy. Un enemy sans cargo pour bouger le pourra au tour suivant,
+        // il part avec les autres (estimation prudente)
+        for (const auto &enemy : enemies)
+        {
+            size_t cell = index_of(enemy.position);
+            if (m_arrival[cell] != 0)
+                m_frontier.push_back(cell);
+            m_arrival[cell] = 0;
+            m_min_cargo[cell] = std::min(m_min_cargo[cell], enemy.halite);
+        }
+
+        // Tour t : chaque cell modifiee au tour t - 1 pousse son cargo min vers ses voisines.
+        // Au-dela de l'horizon seule l'arrivee avance, chaque cell entre au plus une fois dans le front
+        for (int turn = 1; !m_frontier.empty(); ++turn)
+        {
+            bool track_cargo = turn <= m_horizon;
+            const int *previous = &m_min_cargo[std::min(turn - 1, m_horizon) * m_cells];
+            int *current = track_cargo ? &m_min_cargo[turn * m_cells] : nullptr;
+            if (track_cargo)
+                std::copy(previous, previous + m_cells, current);
+
+            m_next.clear();
+            for (size_t cell : m_frontier)
+            {
+                int x = static_cast<int>(cell % m_width);
+                int y = static_cast<int>(cell / m_width);
+                int cargo = previous[cell];
+
+                size_t neighbors[4] = {
+                    static_cast<size_t>(y) * m_width + (x + 1) % m_width,
+                    static_cast<size_t>(y) * m_width + (x + m_width - 1) % m_width,
+                    static_cast<size_t>((y + 1) % m_height) * m_width + x,
+                    static_cast<size_t>((y + m_height - 1) % m_height) * m_width + x};
+
+                for (size_t neighbor : neighbors)
+                {
+                    bool changed = false;
+                    if (m_arrival[neighbor] == UNREACHED)
+                    {
+                        m_arrival[neighbor] = turn;
+                        changed = true;
+                    }
+                    if (track_cargo && cargo < current[neighbor])
+                    {
+                        current[neighbor] = cargo;
+                        changed = true;
+                    }
+
+                    if (changed && !m_queued[neighbor])
+                    {
+                        m_queued[neighbor] = 1;
+                        m_next.push_back(neighbor);
+                    }
+                }
+            }
+
+            for (size_t cell : m_next)
+                m_queued[cell] = 0;
+            m_frontier.swap(m_next);
+        }
+    }
+} // namespace bot
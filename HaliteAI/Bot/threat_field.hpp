@@ -0,0 +1,82 @@
+#pragma once
+
+#include "enemy_index.hpp"
+#include "hlt/position.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bot
+{
+    /// Champs de menace du tour, une seule propagation en largeur depuis tous les ships ennemis :
+    /// premier tour ou un enemy peut atteindre chaque cell, et cargo min des enemies qui peuvent
+    /// y etre en <= k tours pour k <= horizon
+    class ThreatField
+    {
+    public:
+        /// Cell hors d'atteinte de tout enemy
+        static constexpr int UNREACHED = INT_MAX;
+        /// Aucun enemy dans l'horizon
+        static constexpr int NO_CARGO = INT_MAX;
+
+        /// Reconstruit les champs, sans reallocation une fois la capacite atteinte
+        void build(const std::vector<EnemyShipInfo> &enemies, int width, int height, int horizon);
+
+        int horizon() const { return m_horizon; }
+
+        /// Premier tour ou un enemy peut etre sur la cell (0 : occupee), UNREACHED si aucun
+        int arrival(const hlt::Position &pos) const
+        {
+            if (m_arrival.empty())
+                return UNREACHED;
+            return m_arrival[index_of(pos)];
+        }
+
+        /// Cargo min des enemies qui peuvent etre sur la cell en <= turns tours (borne a horizon), NO_CARGO si aucun
+        int min_cargo_within(const hlt::Position &pos, int turns) const
+        {
+            if (m_min_cargo.empty())
+                return NO_CARGO;
+            int plane = turns < 0 ? 0 : (turns > m_horizon ? m_horizon : turns);
+            return m_min_cargo[plane * m_cells + index_of(pos)];
+        }
+
+        /// Premier tour ou un enemy de cargo < cargo peut etre sur la cell, horizon + 1 si aucun dans l'horizon
+        int threat_arrival(const hlt::Position &pos, int cargo) const
+        {
+            if (m_min_cargo.empty())
+                return m_horizon + 1;
+
+            size_t cell = index_of(pos);
+            for (int turn = 0; turn <= m_horizon; ++turn)
+            {
+                if (m_min_cargo[turn * m_cells + cell] < cargo)
+                    return turn;
+            }
+            return m_horizon + 1;
+        }
+
+    private:
+        size_t index_of(const hlt::Position &pos) const
+        {
+            int x = ((pos.x % m_width) + m_width) % m_width;
+            int y = ((pos.y % m_height) + m_height) % m_height;
+            return static_cast<size_t>(y) * m_width + x;
+        }
+
+        int m_width = 0;
+        int m_height = 0;
+        int m_horizon = 0;
+        size_t m_cells = 0;
+
+        std::vector<int> m_arrival;   // Par cell
+        std::vector<int> m_min_cargo; // horizon + 1 plans de m_cells, plan k : cargo min en <= k tours
+
+        // Front de la propagation : cells modifiees au tour precedent
+        std::vector<size_t> m_frontier;
+        std::vector<size_t> m_next;
+        std::vector<uint8_t> m_queued;
+    };
+} // namespace bot
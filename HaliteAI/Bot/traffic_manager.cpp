@@ -3,27 +3,30 @@
 #include "hlt/constants.hpp"
 
 #include <algorithm>
-#include <unordered_map>
 
 namespace bot
 {
-    TrafficManager &TrafficManager::instance()
-    {
-        static TrafficManager inst;
-        return inst;
-    }
-
     // Initialisation du TrafficManager avec les infos de la map et des ships
     void TrafficManager::init(
         hlt::GameMap &game_map,
         const std::vector<hlt::Position> &dropoff_positions,
-        const std::unordered_map<hlt::EntityId, std::shared_ptr<hlt::Ship>> &ships,
-        int turns_remaining)
+        const hlt::EntityTable<hlt::Ship> &ships,
+        int turns_remaining,
+        const BotParams &params,
+        const TurnBudget &budget)
     {
         m_game_map = &game_map;
         m_drops_positions = &dropoff_positions;
         m_ships = &ships;
         m_turns_remaining = turns_remaining;
+        m_params = &params;
+        m_budget = &budget;
+
+        // No-op sauf au premier tour
+        m_occupied.resize(game_map.width, game_map.height);
+        m_pos_to_index.resize(game_map.width, game_map.height);
+        m_holder.resize(game_map.width, game_map.height);
+        m_priority_counts.reserve(constants::TRAFFIC_COUNTING_SORT_RANGE);
     }
 
     // Vérifie si une position est un dropoff
@@ -39,19 +42,19 @@ namespace bot
     }
 
     // Ajuste les PRIORITY des MoveRequest selon la logique de priority
-    void TrafficManager::adjust_priorities(std::vector<MoveRequest> &requests)
+    void TrafficManager::adjust_priorities(MoveRequests &requests)
     {
         for (auto &req : requests)
         {
             // Ship sur un dropoff, HIGH PRIORITY
             if (is_drop_cell(m_game_map->normalize(req.m_current)))
             {
-                req.m_priority = constants::SHIP_ON_DROPOFF_PRIORITY;
+                req.m_priority = m_params->ship_on_dropoff_priority;
                 continue;
             }
 
             // Ship en URGENT RETURN
-            if (req.m_priority < constants::URGENT_RETURN_PRIORITY)
+            if (req.m_priority < m_params->urgent_return_priority)
                 continue;
 
             // Chercher le dropoff le plus proche
@@ -66,48 +69,94 @@ namespace bot
             // Si distance <= 2, c'est URGENT RETURN NEAR
             if (min_dist <= 2)
             {
-                req.m_priority = constants::URGENT_RETURN_NEAR_PRIORITY;
+                req.m_priority = m_params->urgent_return_near_priority;
             }
 
             // Bonus de priorité pour les ships avec beaucoup de halite, pour les faire rentrer plus vite
-            auto ship_it = m_ships->find(req.m_ship_id);
-            if (ship_it != m_ships->end())
+            const hlt::Ship *ship = m_ships->find(req.m_ship_id);
+            if (ship != nullptr)
             {
-                int cargo_bonus = (ship_it->second->halite * 9) / hlt::constants::MAX_HALITE;
+                int cargo_bonus = (ship->halite * 9) / hlt::constants::MAX_HALITE;
                 req.m_priority += cargo_bonus;
             }
         }
     }
 
-    // Résout les conflits de mouvement en fonction des priority
-    void TrafficManager::resolve_conflicts(
-        std::vector<MoveRequest> &requests,
-        std::vector<MoveResult> &results,
-        std::unordered_set<size_t> &resolved_indices)
+    // Trie par comptage : les priorites sont de petits entiers, ordre des requests garde a egalite
+    void TrafficManager::sort_by_priority(const MoveRequests &requests)
     {
+        int min_prio = requests[0].m_priority;
+        int max_prio = requests[0].m_priority;
+        for (const auto &req : requests)
+        {
+            min_prio = std::min(min_prio, req.m_priority);
+            max_prio = std::max(max_prio, req.m_priority);
+        }
 
-        // Map de position normalisée -> index de MoveRequest
-        std::unordered_map<hlt::Position, size_t> pos_to_index;
-        for (size_t i = 0; i < requests.size(); ++i)
+        m_sorted_indices.resize(requests.size());
+
+        // Priorites hors des valeurs habituelles (params) : tri par comparaison, meme ordre
+        if (max_prio - min_prio >= constants::TRAFFIC_COUNTING_SORT_RANGE)
         {
-            hlt::Position normalized = m_game_map->normalize(requests[i].m_current);
-            pos_to_index[normalized] = i;
+            for (size_t i = 0; i < requests.size(); ++i)
+                m_sorted_indices[i] = i;
+
+            std::sort(m_sorted_indices.begin(), m_sorted_indices.end(),
+                      [&requests](size_t a, size_t b)
+                      {
+                          if (requests[a].m_priority != requests[b].m_priority)
+                              return requests[a].m_priority > requests[b].m_priority;
+                          return a < b;
+                      });
+            return;
+        }
+
+        // Bucket 0 = priorite max
+        m_priority_counts.assign(static_cast<size_t>(max_prio - min_prio) + 1, 0);
+        for (const auto &req : requests)
+            ++m_priority_counts[static_cast<size_t>(max_prio - req.m_priority)];
+
+        // Comptes -> debut de chaque bucket
+        size_t offset = 0;
+        for (auto &count : m_priority_counts)
+        {
+            size_t bucket_size = count;
+            count = offset;
+            offset += bucket_size;
         }
 
+        for (size_t i = 0; i < requests.size(); ++i)
+            m_sorted_indices[m_priority_counts[static_cast<size_t>(max_prio - requests[i].m_priority)]++] = i;
+    }
+
+    void TrafficManager::resolve(const MoveRequests &requests, size_t idx, hlt::Direction direction)
+    {
+        m_result_index[idx] = m_results.size();
+        m_results.push_back({requests[idx].m_ship_id, direction});
+        m_resolved[idx] = 1;
+    }
+
+    // Résout les conflits de mouvement en fonction des priority
+    void TrafficManager::resolve_conflicts(const MoveRequests &requests)
+    {
+        // Position normalisée -> index de MoveRequest
+        m_pos_to_index.clear();
+        for (size_t i = 0; i < requests.size(); ++i)
+            m_pos_to_index.set(requests[i].m_current, i);
+
         for (size_t i = 0; i < requests.size(); ++i)
         {
-            if (resolved_indices.count(i))
+            if (m_resolved[i])
                 continue;
 
             // Vérifier les conflits de mouvement : 2-cycles et 3-cycles
             hlt::Position desired_norm = m_game_map->normalize(requests[i].m_desired);
-            auto it = pos_to_index.find(desired_norm);
-            if (it == pos_to_index.end())
+            size_t j = m_pos_to_index.find(desired_norm);
+            if (j == CellIndexMap::NONE)
                 continue;
 
             // Conflit potentiel avec la MoveRequest j
-            size_t j = it->second;
-            if (j == i || resolved_indices.count(j))
+            if (j == i || m_resolved[j])
                 continue;
 
             hlt::Position j_desired_norm = m_game_map->normalize(requests[j].m_desired);
@@ -118,27 +167,20 @@ namespace bot
             {
                 // Résoudre le conflit en fonction des PRIORITY
                 if (requests[i].m_priority >= requests[j].m_priority)
-                {
-                    results.push_back({requests[j].m_ship_id, hlt::Direction::STILL});
-                    resolved_indices.insert(j);
-                }
+                    resolve(requests, j, hlt::Direction::STILL);
                 else
-                {
-                    results.push_back({requests[i].m_ship_id, hlt::Direction::STILL});
-                    resolved_indices.insert(i);
-                }
+                    resolve(requests, i, hlt::Direction::STILL);
 
                 continue;
             }
 
             // 3-cycle : i -> j -> k -> i
-            auto it_k = pos_to_index.find(j_desired_norm);
-            if (it_k == pos_to_index.end())
+            size_t k = m_pos_to_index.find(j_desired_norm);
+            if (k == CellIndexMap::NONE)
                 continue;
 
             // Conflit potentiel avec la MoveRequest k
-            size_t k = it_k->second;
-            if (k == i || k == j || resolved_indices.count(k))
+            if (k == i || k == j || m_resolved[k])
                 continue;
 
             // Vérifier que k veut aller vers la position de i
@@ -150,89 +192,63 @@ namespace bot
 
             // Résoudre le conflit en forçant le STILL du ship avec la PRIORITY la plus basse
             if (requests[i].m_priority == min_prio)
-            {
-                results.push_back({requests[i].m_ship_id, hlt::Direction::STILL});
-                resolved_indices.insert(i);
-            }
+                resolve(requests, i, hlt::Direction::STILL);
             else if (requests[j].m_priority == min_prio)
-            {
-                results.push_back({requests[j].m_ship_id, hlt::Direction::STILL});
-                resolved_indices.insert(j);
-            }
+                resolve(requests, j, hlt::Direction::STILL);
             else
-            {
-                results.push_back({requests[k].m_ship_id, hlt::Direction::STILL});
-                resolved_indices.insert(k);
-            }
+                resolve(requests, k, hlt::Direction::STILL);
         }
     }
 
     // Résout tous les conflits de mouvement et choisit entre desired et alternatives
-    std::vector<MoveResult> TrafficManager::resolve_all(std::vector<MoveRequest> &requests)
+    const MoveResults &TrafficManager::resolve_all(MoveRequests &requests)
     {
-        std::vector<MoveResult> results;
-        results.reserve(requests.size());
-
+        m_results.clear();
         if (requests.empty())
-            return results;
+            return m_results;
+
+        m_results.reserve(requests.size());
+        m_resolved.assign(requests.size(), 0);
+        m_result_index.resize(requests.size());
 
         adjust_priorities(requests);
 
         // Trie des indices par PRIORITY décroissante
-        std::vector<size_t> sorted_indices(requests.size());
-        for (size_t i = 0; i < requests.size(); ++i)
-            sorted_indices[i] = i;
-
-        // Trie par PRIORITY décroissante
-        std::sort(sorted_indices.begin(), sorted_indices.end(),
-                  [&requests](size_t a, size_t b)
-                  {
-                      return requests[a].m_priority > requests[b].m_priority;
-                  });
+        sort_by_priority(requests);
 
         // Détection de conflits
-        std::unordered_set<size_t> resolved_indices;
-        resolve_conflicts(requests, results, resolved_indices);
-
-        // Pos deja réservées par les finals MoveResult
-        std::unordered_set<hlt::Position> occupied_positions;
+        resolve_conflicts(requests);
 
         // Réserver les positions des MoveResult déjà résolus
-        for (const auto &result : results)
+        m_occupied.clear();
+        for (size_t i = 0; i < requests.size(); ++i)
         {
-            for (const auto &req : requests)
-            {
-                if (req.m_ship_id != result.m_ship_id)
-                    continue;
-
-                occupied_positions.insert(m_game_map->normalize(req.m_current));
-                break;
-            }
+            if (m_resolved[i])
+                m_occupied.insert(requests[i].m_current);
         }
 
         // Forcer le STILL des ships stuck
-        manage_stuck_ships(requests, results, resolved_indices, occupied_positions);
+        manage_stuck_ships(requests);
 
         // Choisir entre desired et alternatives pour les MoveRequest restants
-        for (size_t idx : sorted_indices)
+        for (size_t idx : m_sorted_indices)
         {
-            if (resolved_indices.count(idx))
+            if (m_resolved[idx])
                 continue;
 
-            MoveRequest &req = requests[idx];
+            const MoveRequest &req = requests[idx];
             hlt::Position desired_pos = m_game_map->normalize(req.m_desired);
 
             // ENDGAME CASE : Autoriser les collisions sur les drops
             bool on_dropoff_collision_ok = (m_turns_remaining <= 2) && is_drop_cell(desired_pos);
 
             // Desired direction
-            if (occupied_positions.find(desired_pos) == occupied_positions.end() || on_dropoff_collision_ok)
+            if (!m_occupied.contains(desired_pos) || on_dropoff_collision_ok)
             {
-                results.push_back({req.m_ship_id, req.m_desired_direction});
-                resolved_indices.insert(idx);
+                resolve(requests, idx, req.m_desired_direction);
 
                 if (!on_dropoff_collision_ok)
-                    occupied_positions.insert(desired_pos);
+                    m_occupied.insert(desired_pos);
 
                 continue;
             }
@@ -243,11 +259,10 @@ namespace bot
             {
                 hlt::Position alt_pos = m_game_map->normalize(req.m_current.directional_offset(alt_dir));
 
-                if (occupied_positions.find(alt_pos) == occupied_positions.end())
+                if (!m_occupied.contains(alt_pos))
                 {
-                    results.push_back({req.m_ship_id, alt_dir});
-                    resolved_indices.insert(idx);
-                    occupied_positions.insert(alt_pos);
+                    resolve(requests, idx, alt_dir);
+                    m_occupied.insert(alt_pos);
                     found_alt = true;
                     break;
                 }
@@ -257,34 +272,112 @@ namespace bot
                 continue;
 
             // Fallback STILL
-            results.push_back({req.m_ship_id, hlt::Direction::STILL});
-            resolved_indices.insert(idx);
-            occupied_positions.insert(m_game_map->normalize(req.m_current));
+            resolve(requests, idx, hlt::Direction::STILL);
+            m_occupied.insert(req.m_current);
         }
 
-        return results;
+        refine_assignments(requests);
+
+        return m_results;
+    }
+
+    bool TrafficManager::is_ship_stuck(const MoveRequest &req) const
+    {
+        const hlt::Ship *ship = m_ships->find(req.m_ship_id);
+        if (ship == nullptr)
+            return false;
+
+        int move_cost = m_game_map->at(ship->position)->halite / hlt::constants::MOVE_COST_RATIO;
+        return ship->halite < move_cost;
+    }
+
+    // Raffinement anytime : chaque passe ameliore l'assignation, arret au budget epuise ou sans gain
+    void TrafficManager::refine_assignments(const MoveRequests &requests)
+    {
+        // Cell finale -> request qui y termine
+        m_holder.clear();
+        for (size_t idx = 0; idx < requests.size(); ++idx)
+        {
+            const MoveRequest &req = requests[idx];
+            hlt::Direction dir = m_results[m_result_index[idx]].m_final_direction;
+            m_holder.set(req.m_current.directional_offset(dir), idx);
+        }
+
+        for (int pass = 0; pass < constants::TRAFFIC_REFINE_PASSES; ++pass)
+        {
+            if (!m_budget->has_time(constants::TRAFFIC_BUDGET_FRACTION))
+                return;
+
+            bool improved = false;
+            for (size_t idx : m_sorted_indices)
+            {
+                const MoveRequest &req = requests[idx];
+                MoveResult &result = m_results[m_result_index[idx]];
+                if (result.m_final_direction != hlt::Direction::STILL ||
+                    req.m_desired_direction == hlt::Direction::STILL || is_ship_stuck(req))
+                    continue;
+
+                hlt::Position current = m_game_map->normalize(req.m_current);
+                hlt::Position desired = m_game_map->normalize(req.m_desired);
+                if (is_drop_cell(desired))
+                    continue;
+
+                size_t other = m_holder.find(desired);
+                if (other != CellIndexMap::NONE)
+                {
+                    // Le ship qui tient la cell doit etre moins prioritaire et pouvoir bouger
+                    const MoveRequest &other_req = requests[other];
+                    if (other_req.m_priority >= req.m_priority || is_ship_stuck(other_req))
+                        continue;
+
+                    // Pas de deplacement vers un move que son etat juge dangereux
+                    bool moved = false;
+                    const DirectionList &alternatives = other_req.m_alternatives;
+                    for (size_t a = 0; a < alternatives.size(); ++a)
+                    {
+                        hlt::Direction alt_dir = alternatives[a];
+                        hlt::Position alt_pos = m_game_map->normalize(other_req.m_current.directional_offset(alt_dir));
+                        if (alt_pos == desired || m_holder.contains(alt_pos) ||
+                            alternatives.score(a) <= constants::MOVE_SCORE_UNSAFE)
+                            continue;
+
+                        m_results[m_result_index[other]].m_final_direction = alt_dir;
+                        m_holder.set(alt_pos, other);
+                        moved = true;
+                        break;
+                    }
+
+                    if (!moved)
+                        continue;
+                }
+
+                result.m_final_direction = req.m_desired_direction;
+                m_holder.set(desired, idx);
+                if (m_holder.find(current) == idx)
+                    m_holder.erase(current);
+                improved = true;
+            }
+
+            if (!improved)
+                return;
+        }
     }
 
     // Forcer le STILL des ships qui n'ont pas assez de halite pour bouger
-    void TrafficManager::manage_stuck_ships(
-        std::vector<MoveRequest> &requests,
-        std::vector<MoveResult> &results,
-        std::unordered_set<size_t> &resolved_indices,
-        std::unordered_set<hlt::Position> &occupied_positions)
+    void TrafficManager::manage_stuck_ships(const MoveRequests &requests)
     {
         for (size_t i = 0; i < requests.size(); ++i)
         {
-            if (resolved_indices.count(i))
+            if (m_resolved[i])
                 continue;
 
-            MoveRequest &req = requests[i];
+            const MoveRequest &req = requests[i];
 
-            auto ship_it = m_ships->find(req.m_ship_id);
-            if (ship_it == m_ships->end())
+            const hlt::Ship *ship = m_ships->find(req.m_ship_id);
+            if (ship == nullptr)
                 continue;
 
             // Si pas assez de halite pour bouger
-            const auto &ship = ship_it->second;
             int cell_halite = m_game_map->at(ship->position)->halite;
             int move_cost = cell_halite / hlt::constants::MOVE_COST_RATIO;
 
@@ -293,9 +386,8 @@ namespace bot
             // Forcer STILL
             if (is_ship_stuck)
             {
-                results.push_back({req.m_ship_id, hlt::Direction::STILL});
-                resolved_indices.insert(i);
-                occupied_positions.insert(m_game_map->normalize(req.m_current));
+                resolve(requests, i, hlt::Direction::STILL);
+                m_occupied.insert(req.m_current);
             }
         }
     }
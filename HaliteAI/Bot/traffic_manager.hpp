@@ -1,24 +1,26 @@
 #pragma once
 
 #include "move_request.hpp"
+#include "cell_set.hpp"
+#include "bot_params.hpp"
+#include "turn_budget.hpp"
 #include "hlt/entity.hpp"
 #include "hlt/position.hpp"
 #include "hlt/direction.hpp"
 #include "hlt/command.hpp"
 #include "hlt/game_map.hpp"
 #include "hlt/ship.hpp"
+#include "hlt/entity_table.hpp"
 
+#include <cstdint>
 #include <vector>
-#include <memory>
-#include <unordered_set>
-#include <unordered_map>
 
 namespace bot
 {
     class TrafficManager
     {
     public:
-        static TrafficManager &instance();
+        TrafficManager() = default;
 
         // Non-copiable
         TrafficManager(const TrafficManager &) = delete;
@@ -27,38 +29,57 @@ namespace bot
         // Initialise le contexte du tour courant
         void init(hlt::GameMap &game_map,
                   const std::vector<hlt::Position> &drops_positions,
-                  const std::unordered_map<hlt::EntityId, std::shared_ptr<hlt::Ship>> &ships,
-                  int turns_remaining);
+                  const hlt::EntityTable<hlt::Ship> &ships,
+                  int turns_remaining,
+                  const BotParams &params,
+                  const TurnBudget &budget);
 
-        // Résout tous les conflits de mouvement
-        std::vector<MoveResult> resolve_all(std::vector<MoveRequest> &requests);
+        // Résout tous les conflits de mouvement. Resultats valides jusqu'au prochain appel
+        const MoveResults &resolve_all(MoveRequests &requests);
 
     private:
-        TrafficManager() = default;
-
         // Verif si une position est un drop
         bool is_drop_cell(const hlt::Position &pos) const;
 
         // Ajuste les priorités des MoveRequests selon la situation
-        void adjust_priorities(std::vector<MoveRequest> &requests);
+        void adjust_priorities(MoveRequests &requests);
+
+        // Trie stable des indices de requests par priorité décroissante dans m_sorted_indices
+        void sort_by_priority(const MoveRequests &requests);
+
+        // Fixe le MoveResult de la request idx
+        void resolve(const MoveRequests &requests, size_t idx, hlt::Direction direction);
 
         // Résout les conflits de mouvement en fonction des priorités
-        void resolve_conflicts(
-            std::vector<MoveRequest> &requests,
-            std::vector<MoveResult> &results,
-            std::unordered_set<size_t> &resolved_indices);
+        void resolve_conflicts(const MoveRequests &requests);
+
+        // True si le ship n'a pas assez de halite pour quitter sa cell
+        bool is_ship_stuck(const MoveRequest &req) const;
+
+        // Passes de raffinement tant que le budget le permet : un ship STILL faute de place
+        // prend sa cell desiree si le ship moins prioritaire qui l'occupe peut aller ailleurs
+        void refine_assignments(const MoveRequests &requests);
 
         // Forcer le STILL des ships qui n'ont pas assez de halite pour bouger
-        void manage_stuck_ships(
-            std::vector<MoveRequest> &requests,
-            std::vector<MoveResult> &results,
-            std::unordered_set<size_t> &resolved_indices,
-            std::unordered_set<hlt::Position> &occupied_positions);
+        void manage_stuck_ships(const MoveRequests &requests);
 
         // Contexte du tour
         hlt::GameMap *m_game_map = nullptr;
         const std::vector<hlt::Position> *m_drops_positions = nullptr;
-        const std::unordered_map<hlt::EntityId, std::shared_ptr<hlt::Ship>> *m_ships = nullptr;
+        const hlt::EntityTable<hlt::Ship> *m_ships = nullptr;
         int m_turns_remaining = 0;
+        const BotParams *m_params = nullptr;
+        const TurnBudget *m_budget = nullptr;
+
+        // Scratch garde d'un tour a l'autre, a la taille de la plus grande flotte vue :
+        // resolve_all n'alloue plus rien ensuite. Resultats hors arena, ils survivent au tour
+        MoveResults m_results{MoveResults::allocator_type(nullptr)};
+        std::vector<size_t> m_sorted_indices;
+        std::vector<size_t> m_priority_counts;
+        std::vector<uint8_t> m_resolved;       // Par index de request
+        std::vector<size_t> m_result_index;    // Request -> son MoveResult
+        CellSet m_occupied;                    // Cells deja reservees par un MoveResult
+        CellIndexMap m_pos_to_index;           // Cell courante -> request
+        CellIndexMap m_holder;                 // Cell finale -> request, pour le raffinement
     };
 } // namespace bot
\ No newline at end of file
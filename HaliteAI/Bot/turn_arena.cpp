@@ -0,0 +1,71 @@
+#include "turn_arena.hpp"
+
+namespace bot
+{
+    constexpr size_t TurnArena::ALIGNMENT;
+
+    namespace
+    {
+        // Hors de la classe et hors ligne : UBSan de GCC signale a tort les thread_local membres statiques
+        thread_local TurnArena *t_current_arena = nullptr;
+    } // namespace
+
+    TurnArena::TurnArena(size_t initial_bytes)
+        : m_block(new char[round_up(initial_bytes)]), m_capacity(round_up(initial_bytes))
+    {
+    }
+
+    TurnArena *TurnArena::current()
+    {
+        return t_current_arena;
+    }
+
+    TurnArena::Scope::Scope(TurnArena *arena) : m_previous(t_current_arena)
+    {
+        t_current_arena = arena;
+    }
+
+    TurnArena::Scope::~Scope()
+    {
+        t_current_arena = m_previous;
+    }
+
+    void *TurnArena::allocate(size_t bytes)
+    {
+        size_t size = round_up(bytes == 0 ? 1 : bytes);
+        size_t offset = m_offset.fetch_add(size, std::memory_order_relaxed);
+        if (offset + size <= m_capacity)
+            return m_block.get() + offset;
+
+        return allocate_overflow(size);
+    }
+
+    void *TurnArena::allocate_overflow(size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_overflow_mutex);
+        m_overflow_blocks.emplace_back(new char[bytes]);
+        m_overflow_bytes += bytes;
+        return m_overflow_blocks.back().get();
+    }
+
+    void TurnArena::reset()
+    {
+        // Debordement au tour precedent : bloc principal agrandi au pic, marge de moitie
+        if (!m_overflow_blocks.empty())
+        {
+            size_t peak = used();
+            m_overflow_blocks.clear();
+            m_overflow_bytes = 0;
+            m_capacity = round_up(peak + peak / 2);
+            m_block.reset(new char[m_capacity]);
+        }
+
+        m_offset.store(0, std::memory_order_relaxed);
+    }
+
+    size_t TurnArena::used() const
+    {
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        return (offset < m_capacity ? offset : m_capacity) + m_overflow_bytes;
+    }
+} // namespace bot
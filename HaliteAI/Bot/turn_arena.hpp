@@ -0,0 +1,129 @@
+#pragma once
+
+#include "bot_constants.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bot
+{
+    /// Arena bump-pointer des donnees transitoires d'un tour, remise a zero au debut de play_turn.
+    /// allocate est sans lock (un fetch_add) et peut etre appele par les workers de la phase de
+    /// decision. Un bloc plein deborde sur des blocs du heap, et reset agrandit le bloc principal
+    /// au pic observe : les tours suivants n'allouent plus rien sur le heap.
+    /// bench --turn-allocs verifie qu'un tour complet en regime permanent n'alloue rien
+    class TurnArena
+    {
+    public:
+        /// Alignement de toutes les allocations
+        static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+        explicit TurnArena(size_t initial_bytes = constants::TURN_ARENA_BYTES);
+
+        // Non-copiable
+        TurnArena(const TurnArena &) = delete;
+        TurnArena &operator=(const TurnArena &) = delete;
+
+        /// bytes arrondi a ALIGNMENT. Thread-safe, jamais concurrent avec reset
+        void *allocate(size_t bytes);
+
+        /// Libere tout ce qui a ete alloue depuis le dernier reset
+        void reset();
+
+        /// Octets alloues depuis le dernier reset, debordement compris
+        size_t used() const;
+
+        size_t capacity() const { return m_capacity; }
+
+        /// Arena des conteneurs crees par ce thread, nullptr hors d'un Scope
+        static TurnArena *current();
+
+        /// Installe une arena comme courante pour le thread, jusqu'a la fin du scope
+        class Scope
+        {
+        public:
+            explicit Scope(TurnArena *arena);
+            ~Scope();
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            TurnArena *m_previous;
+        };
+
+    private:
+        static size_t round_up(size_t bytes) { return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+        /// Bloc du heap pour une allocation qui ne tient plus dans le bloc principal
+        void *allocate_overflow(size_t bytes);
+
+        std::unique_ptr<char[]> m_block;
+        size_t m_capacity = 0;
+        std::atomic<size_t> m_offset{0};
+
+        std::mutex m_overflow_mutex;
+        std::vector<std::unique_ptr<char[]>> m_overflow_blocks;
+        size_t m_overflow_bytes = 0;
+    };
+
+    /// Allocateur STL sur l'arena courante du thread a la construction. Hors d'un TurnArena::Scope,
+    /// repli sur le heap. Une copie de conteneur va dans l'arena courante de celui qui copie
+    template <class T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        ArenaAllocator() noexcept : m_arena(TurnArena::current()) {}
+        explicit ArenaAllocator(TurnArena *arena) noexcept : m_arena(arena) {}
+
+        template <class U>
+        ArenaAllocator(const ArenaAllocator<U> &other) noexcept : m_arena(other.arena()) {}
+
+        T *allocate(size_t n)
+        {
+            static_assert(alignof(T) <= TurnArena::ALIGNMENT, "alignement superieur a celui de l'arena");
+            if (m_arena != nullptr)
+                return static_cast<T *>(m_arena->allocate(n * sizeof(T)));
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+
+        /// No-op dans l'arena : la memoire est rendue par reset
+        void deallocate(T *ptr, size_t) noexcept
+        {
+            if (m_arena == nullptr)
+                ::operator delete(ptr);
+        }
+
+        ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+        TurnArena *arena() const noexcept { return m_arena; }
+
+    private:
+        TurnArena *m_arena;
+    };
+
+    template <class T, class U>
+    bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) noexcept
+    {
+        return a.arena() == b.arena();
+    }
+
+    template <class T, class U>
+    bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b) noexcept
+    {
+        return !(a == b);
+    }
+
+    /// Vecteur transitoire du tour, dans l'arena courante
+    template <class T>
+    using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+} // namespace bot
@@ -0,0 +1,49 @@
+#include "turn_budget.hpp"
+#include "bot_constants.hpp"
+
+#include <algorithm>
+
+namespace bot
+{
+    TurnBudget::TurnBudget()
+        : m_start(Clock::now()),
+          m_budget_ms(constants::TURN_TIME_LIMIT_MS * constants::TURN_TIME_SAFETY),
+          m_ms_per_ship(0.0), m_base_ms(0.0), m_last_turn_ms(0.0), m_calibrated(false)
+    {
+    }
+
+    void TurnBudget::start_turn()
+    {
+        m_start = Clock::now();
+    }
+
+    double TurnBudget::elapsed_ms() const
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - m_start).count();
+    }
+
+    // Modele lineaire turn_ms = base + ships * cout_ship.
+    // Base : tour le moins cher observe (stats map, heatmap), le reste est reparti par ship
+    void TurnBudget::end_turn(int ship_count)
+    {
+        m_last_turn_ms = elapsed_ms();
+
+        if (!m_calibrated)
+        {
+            m_base_ms = m_last_turn_ms;
+            m_calibrated = true;
+            return;
+        }
+
+        m_base_ms = std::min(m_base_ms, m_last_turn_ms);
+        double per_ship = (m_last_turn_ms - m_base_ms) / std::max(1, ship_count);
+        m_ms_per_ship += constants::TURN_TIME_SMOOTHING * (per_ship - m_ms_per_ship);
+    }
+
+    double TurnBudget::predicted_turn_ms(int ship_count) const
+    {
+        if (!m_calibrated)
+            return 0.0;
+        return m_base_ms + m_ms_per_ship * std::max(0, ship_count);
+    }
+} // namespace bot
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+
+namespace bot
+{
+    /// Budget de temps du tour, mesure depuis le debut de play_turn.
+    /// Les etapes couteuses (explore, dropoff, trafic) s'approfondissent tant que
+    /// has_time(fraction) est vrai et rendent leur meilleur resultat sinon.
+    /// Le cout par ship est calibre sur les tours mesures pour dimensionner le travail du tour suivant.
+    class TurnBudget
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        TurnBudget();
+
+        /// Debut du tour (premier appel de play_turn)
+        void start_turn();
+
+        /// Fin du tour : mesure et calibration
+        void end_turn(int ship_count);
+
+        /// Temps ecoule depuis start_turn, en ms
+        double elapsed_ms() const;
+
+        /// Budget total du tour, en ms
+        double budget_ms() const { return m_budget_ms; }
+
+        /// True tant qu'on est sous fraction * budget, lisible depuis les workers
+        bool has_time(double fraction) const
+        {
+            return Clock::now() < m_start + std::chrono::duration_cast<Clock::duration>(
+                                                std::chrono::duration<double, std::milli>(fraction * m_budget_ms));
+        }
+
+        /// Temps predit d'un tour avec ship_count ships, d'apres les tours mesures
+        double predicted_turn_ms(int ship_count) const;
+
+        /// Duree du dernier tour mesure, en ms
+        double last_turn_ms() const { return m_last_turn_ms; }
+
+    private:
+        Clock::time_point m_start;
+        double m_budget_ms;
+        double m_ms_per_ship;   // Moyenne glissante du cout d'un ship
+        double m_base_ms;       // Cout fixe d'un tour (min observe)
+        double m_last_turn_ms;
+        bool m_calibrated;
+    };
+} // namespace bot
@@ -0,0 +1,139 @@
+#include "map_generator.hpp"
+#include "rng.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sim
+{
+    namespace
+    {
+        constexpr double MAX_CELL_HALITE = 1000.0;
+
+        double smoothstep(double t)
+        {
+            return t * t * (3.0 - 2.0 * t);
+        }
+
+        // Une octave de bruit de valeur : grille de lattice x lattice valeurs aleatoires
+        // interpolees (smoothstep) sur la tuile, ajoutee a tile avec le poids amplitude
+        void add_value_noise(std::vector<double> &tile, int tile_w, int tile_h, int lattice, double amplitude,
+                             Rng &rng)
+        {
+            int stride = lattice + 1;
+            std::vector<double> grid(static_cast<size_t>(stride) * stride);
+            for (auto &value : grid)
+                value = rng.uniform();
+
+            for (int y = 0; y < tile_h; ++y)
+            {
+                double gy = static_cast<double>(y) * lattice / tile_h;
+                int iy = static_cast<int>(gy);
+                double fy = smoothstep(gy - iy);
+
+                for (int x = 0; x < tile_w; ++x)
+                {
+                    double gx = static_cast<double>(x) * lattice / tile_w;
+                    int ix = static_cast<int>(gx);
+                    double fx = smoothstep(gx - ix);
+
+                    double v00 = grid[static_cast<size_t>(iy) * stride + ix];
+                    double v10 = grid[static_cast<size_t>(iy) * stride + ix + 1];
+                    double v01 = grid[static_cast<size_t>(iy + 1) * stride + ix];
+                    double v11 = grid[static_cast<size_t>(iy + 1) * stride + ix + 1];
+
+                    double top = v00 + (v10 - v00) * fx;
+                    double bottom = v01 + (v11 - v01) * fx;
+                    tile[static_cast<size_t>(y) * tile_w + x] += amplitude * (top + (bottom - top) * fy);
+                }
+            }
+        }
+    } // namespace
+
+    GeneratedMap generate_map(int width, int height, int num_players, uint64_t seed)
+    {
+        Rng rng(seed);
+
+        // Tuile generee puis copiee en miroir : chaque joueur voit la meme map.
+        // Arrondi superieur pour les tailles impaires : la colonne (ligne) centrale
+        // est son propre miroir et doit exister dans la tuile
+        int tile_w = (width + 1) / 2;
+        int tile_h = (num_players == 4) ? (height + 1) / 2 : height;
+        std::vector<double> tile(static_cast<size_t>(tile_w) * tile_h, 0.0);
+
+        // Octaves de 2 cells de lattice jusqu'a ~2 cells par point : grands bancs puis details
+        double persistence = 0.55 + 0.2 * rng.uniform();
+        double amplitude = 1.0;
+        for (int lattice = 2; lattice <= std::max(tile_w, tile_h) / 2; lattice *= 2)
+        {
+            add_value_noise(tile, tile_w, tile_h, lattice, amplitude, rng);
+            amplitude *= persistence;
+        }
+
+        // Normalisation puis puissance : la plupart des cells pauvres, quelques bancs riches
+        auto bounds = std::minmax_element(tile.begin(), tile.end());
+        double low = *bounds.first;
+        double range = std::max(1e-9, *bounds.second - low);
+        double power = 2.5 + rng.uniform();
+
+        double sum = 0.0;
+        for (auto &value : tile)
+        {
+            double jitter = 0.85 + 0.3 * rng.uniform();
+            value = std::pow((value - low) / range, power) * jitter;
+            sum += value;
+        }
+
+        // Moyenne par cell tiree dans la plage des maps officielles
+        double target_mean = 120.0 + 160.0 * rng.uniform();
+        double scale = target_mean * tile.size() / std::max(1e-9, sum);
+
+        GeneratedMap map;
+        map.width = width;
+        map.height = height;
+        map.halite.assign(static_cast<size_t>(width) * height, 0);
+
+        for (int y = 0; y < height; ++y)
+        {
+            int ty = (y < tile_h) ? y : height - 1 - y;
+            for (int x = 0; x < width; ++x)
+            {
+                int tx = (x < tile_w) ? x : width - 1 - x;
+                double value = std::min(MAX_CELL_HALITE, tile[static_cast<size_t>(ty) * tile_w + tx] * scale);
+                map.halite[static_cast<size_t>(y) * width + x] = static_cast<int>(value);
+            }
+        }
+
+        // Shipyards au centre de chaque tuile miroir
+        hlt::Position base(tile_w / 2, tile_h / 2);
+        for (int i = 0; i < num_players; ++i)
+            map.shipyards.push_back(mirror_position(base, i, width, height));
+
+        for (const auto &yard : map.shipyards)
+            map.halite[static_cast<size_t>(yard.y) * width + yard.x] = 0;
+
+        return map;
+    }
+
+    hlt::Position mirror_position(const hlt::Position &pos, int player_id, int width, int height)
+    {
+        int x = (player_id % 2 == 1) ? width - 1 - pos.x : pos.x;
+        int y = (player_id >= 2) ? height - 1 - pos.y : pos.y;
+        return hlt::Position(x, y);
+    }
+
+    std::unique_ptr<hlt::GameMap> make_game_map(int width, int height, const std::vector<int> &halite)
+    {
+        std::unique_ptr<hlt::GameMap> map = std::make_unique<hlt::GameMap>();
+        map->width = width;
+        map->height = height;
+        map->cells.resize(static_cast<size_t>(height));
+        for (int y = 0; y < height; ++y)
+        {
+            map->cells[y].reserve(static_cast<size_t>(width));
+            for (int x = 0; x < width; ++x)
+                map->cells[y].push_back(hlt::MapCell(x, y, halite[static_cast<size_t>(y) * width + x]));
+        }
+        return map;
+    }
+} // namespace sim
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "hlt/position.hpp"
+#include "hlt/game_map.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sim
+{
+    /// Map generee : halite par cell (row-major) + shipyard de chaque joueur
+    struct GeneratedMap
+    {
+        int width;
+        int height;
+        std::vector<int> halite;
+        std::vector<hlt::Position> shipyards;
+
+        int at(int x, int y) const { return halite[static_cast<size_t>(y) * width + x]; }
+    };
+
+    /// Map symetrique (miroir horizontal en 2 joueurs, 4 quadrants en 4 joueurs).
+    /// Halite en bruit de valeur fractal comme le generateur du moteur : octaves lissees
+    /// sommees avec persistance, contraste par puissance, moyenne tiree au hasard.
+    /// Deterministe pour une seed donnee
+    GeneratedMap generate_map(int width, int height, int num_players, uint64_t seed);
+
+    /// Position miroir de pos (vue du joueur 0) pour le joueur player_id
+    hlt::Position mirror_position(const hlt::Position &pos, int player_id, int width, int height);
+
+    /// hlt::GameMap rempli avec le halite row-major donne
+    std::unique_ptr<hlt::GameMap> make_game_map(int width, int height, const std::vector<int> &halite);
+} // namespace sim
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sim
+{
+    /// RNG splitmix64 : meme sequence sur toutes les plateformes (pas de std::distribution)
+    class Rng
+    {
+    public:
+        explicit Rng(uint64_t seed) : m_state(seed) {}
+
+        uint64_t next()
+        {
+            uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        /// Entier uniforme dans [lo, hi]
+        int uniform_int(int lo, int hi)
+        {
+            uint64_t span = static_cast<uint64_t>(hi - lo) + 1;
+            return lo + static_cast<int>(next() % span);
+        }
+
+        /// Reel uniforme dans [0, 1)
+        double uniform()
+        {
+            return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+    private:
+        uint64_t m_state;
+    };
+} // namespace sim
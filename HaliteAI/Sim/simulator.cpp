@@ -0,0 +1,503 @@
+#include "simulator.hpp"
+#include "hlt/constants.hpp"
+#include "hlt/log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace sim
+{
+    namespace
+    {
+        constexpr int INITIAL_HALITE = 5000;
+
+        bool is_valid_direction(char c)
+        {
+            return c == 'n' || c == 's' || c == 'e' || c == 'w' || c == 'o';
+        }
+    } // namespace
+
+    void set_default_constants(int map_width, int max_turns)
+    {
+        // 400 tours en 32x32, +25 par palier de 8 cells, 500 en 64x64
+        int turns = max_turns > 0 ? max_turns : 400 + (map_width - 32) / 8 * 25;
+
+        // Deja en place : pas d'ecriture, les parties paralleles de meme taille ne se marchent pas dessus
+        if (hlt::constants::MAX_TURNS == turns && hlt::constants::MAX_HALITE == 1000)
+            return;
+
+        hlt::constants::SHIP_COST = 1000;
+        hlt::constants::DROPOFF_COST = 4000;
+        hlt::constants::MAX_HALITE = 1000;
+        hlt::constants::EXTRACT_RATIO = 4;
+        hlt::constants::MOVE_COST_RATIO = 10;
+        hlt::constants::INSPIRATION_ENABLED = true;
+        hlt::constants::INSPIRATION_RADIUS = 4;
+        hlt::constants::INSPIRATION_SHIP_COUNT = 2;
+        hlt::constants::INSPIRED_EXTRACT_RATIO = 4;
+        hlt::constants::INSPIRED_BONUS_MULTIPLIER = 2.0;
+        hlt::constants::INSPIRED_MOVE_COST_RATIO = 10;
+        hlt::constants::MAX_TURNS = turns;
+    }
+
+    Simulator::Simulator(const GameConfig &config)
+        : m_config(config), m_width(config.width), m_height(config.height), m_turn(1),
+          m_next_ship_id(0), m_next_dropoff_id(0)
+    {
+        // Plusieurs bots par process : pas de fichier de log par bot
+        hlt::log::set_enabled(false);
+
+        set_default_constants(config.width, config.max_turns);
+        m_max_turns = hlt::constants::MAX_TURNS;
+
+        GeneratedMap map = generate_map(config.width, config.height, config.num_players, config.seed);
+        m_halite = map.halite;
+        m_structure_owner.assign(m_halite.size(), -1);
+        m_cell_count.assign(m_halite.size(), 0);
+
+        for (int i = 0; i < config.num_players; ++i)
+        {
+            PlayerState player;
+            player.id = i;
+            player.shipyard = map.shipyards[i];
+            player.halite = INITIAL_HALITE;
+            player.alive = true;
+            player.stats.id = i;
+            player.wants_spawn = false;
+            m_players.push_back(player);
+
+            m_structure_owner[index_of(player.shipyard)] = i;
+        }
+    }
+
+    // BOTS
+
+    GameResult Simulator::run(const std::vector<BotFactory> &bots)
+    {
+        struct Seat
+        {
+            std::unique_ptr<hlt::Game> game;
+            std::unique_ptr<bot::BotPlayer> bot; // Detruit avant le game qu'il reference
+        };
+
+        std::vector<Seat> seats(m_players.size());
+        for (size_t i = 0; i < seats.size(); ++i)
+        {
+            seats[i].game = make_view(static_cast<hlt::PlayerId>(i));
+            seats[i].bot = bots[i](*seats[i].game);
+        }
+
+        while (!is_over())
+        {
+            for (size_t i = 0; i < seats.size(); ++i)
+            {
+                if (!m_players[i].alive)
+                    continue;
+
+                sync_view(*seats[i].game);
+
+                auto start = std::chrono::steady_clock::now();
+                const std::vector<hlt::Command> &commands = seats[i].bot->play_turn();
+                auto end = std::chrono::steady_clock::now();
+
+                m_players[i].stats.turn_ms.push_back(
+                    std::chrono::duration<float, std::milli>(end - start).count());
+
+                submit(static_cast<hlt::PlayerId>(i), commands);
+            }
+
+            step();
+        }
+
+        return result();
+    }
+
+    std::unique_ptr<hlt::Game> Simulator::make_view(hlt::PlayerId player_id) const
+    {
+        std::vector<std::shared_ptr<hlt::Player>> players;
+        for (const auto &player : m_players)
+            players.push_back(std::make_shared<hlt::Player>(player.id, player.shipyard.x, player.shipyard.y));
+
+        std::unique_ptr<hlt::Game> view =
+            std::make_unique<hlt::Game>(player_id, players, make_game_map(m_width, m_height, m_halite));
+        sync_view(*view);
+        return view;
+    }
+
+    // Equivalent de Game::update_frame sans passer par stdin
+    void Simulator::sync_view(hlt::Game &view) const
+    {
+        view.turn_number = m_turn;
+
+        for (const auto &player : m_players)
+        {
+            hlt::Player &view_player = *view.players[player.id];
+            view_player.halite = player.halite;
+            view_player.ships.clear();
+            view_player.dropoffs.clear();
+
+            for (const auto &dropoff : player.dropoffs)
+                view_player.dropoffs.add(hlt::Dropoff(player.id, dropoff.id, dropoff.position.x, dropoff.position.y));
+        }
+
+        for (const auto &ship : m_ships)
+            view.players[ship.owner]->ships.add(
+                hlt::Ship(ship.owner, ship.id, ship.position.x, ship.position.y, ship.halite));
+
+        for (int y = 0; y < m_height; ++y)
+        {
+            for (int x = 0; x < m_width; ++x)
+            {
+                hlt::MapCell &cell = view.game_map->cells[y][x];
+                cell.halite = m_halite[index_of(hlt::Position(x, y))];
+                cell.clear_ship();
+            }
+        }
+
+        view._sync_entities();
+    }
+
+    // COMMANDES
+
+    Simulator::ShipState *Simulator::find_ship(hlt::EntityId id, hlt::PlayerId owner)
+    {
+        if (id < 0 || id >= static_cast<hlt::EntityId>(m_ship_slot.size()) || m_ship_slot[id] < 0)
+            return nullptr;
+
+        ShipState &ship = m_ships[m_ship_slot[id]];
+        return ship.owner == owner ? &ship : nullptr;
+    }
+
+    // Commandes invalides ignorees (ship inconnu, adverse ou deja commande)
+    void Simulator::submit(hlt::PlayerId player_id, const std::vector<hlt::Command> &commands)
+    {
+        PlayerState &player = m_players[player_id];
+
+        for (const auto &command : commands)
+        {
+            if (command.empty())
+                continue;
+
+            if (command[0] == 'g')
+            {
+                player.wants_spawn = true;
+                continue;
+            }
+
+            if (command.size() < 3 || (command[0] != 'm' && command[0] != 'c'))
+                continue;
+
+            char *end = nullptr;
+            long id = std::strtol(command.c_str() + 2, &end, 10);
+            ShipState *ship = find_ship(static_cast<hlt::EntityId>(id), player_id);
+            if (!ship || ship->converting)
+                continue;
+
+            if (command[0] == 'c')
+            {
+                ship->converting = true;
+                player.constructs.push_back(ship->id);
+                continue;
+            }
+
+            if (end && *end == ' ' && is_valid_direction(end[1]))
+                ship->command = static_cast<hlt::Direction>(end[1]);
+        }
+    }
+
+    // TOUR
+
+    bool Simulator::is_over() const
+    {
+        if (m_turn > m_max_turns)
+            return true;
+
+        int alive = 0;
+        for (const auto &player : m_players)
+            if (player.alive)
+                ++alive;
+
+        return m_players.size() > 1 ? alive <= 1 : alive == 0;
+    }
+
+    void Simulator::step()
+    {
+        update_inspiration();
+        process_constructs();
+        process_moves();
+        process_spawns();
+        process_collisions();
+        process_mining();
+        process_deposits();
+        remove_destroyed_ships();
+        update_eliminations();
+        reset_commands();
+
+        ++m_turn;
+    }
+
+    void Simulator::reset_commands()
+    {
+        for (auto &ship : m_ships)
+        {
+            ship.command = hlt::Direction::STILL;
+            ship.converting = false;
+            ship.moved = false;
+        }
+
+        for (auto &player : m_players)
+        {
+            player.wants_spawn = false;
+            player.constructs.clear();
+        }
+    }
+
+    // Un ship est inspire si assez de ships adverses sont dans INSPIRATION_RADIUS
+    void Simulator::update_inspiration()
+    {
+        int radius = hlt::constants::INSPIRATION_RADIUS;
+        int needed = hlt::constants::INSPIRATION_SHIP_COUNT;
+
+        for (auto &ship : m_ships)
+        {
+            ship.inspired = false;
+            if (!hlt::constants::INSPIRATION_ENABLED)
+                continue;
+
+            int count = 0;
+            for (const auto &other : m_ships)
+            {
+                if (other.owner == ship.owner)
+                    continue;
+
+                int dx = std::abs(ship.position.x - other.position.x);
+                int dy = std::abs(ship.position.y - other.position.y);
+                int dist = std::min(dx, m_width - dx) + std::min(dy, m_height - dy);
+                if (dist > radius)
+                    continue;
+
+                if (++count >= needed)
+                {
+                    ship.inspired = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Conversion : le cargo et le halite de la cell reduisent le cout
+    void Simulator::process_constructs()
+    {
+        for (auto &player : m_players)
+        {
+            for (hlt::EntityId id : player.constructs)
+            {
+                ShipState &ship = m_ships[m_ship_slot[id]];
+                size_t cell = index_of(ship.position);
+
+                if (m_structure_owner[cell] >= 0)
+                {
+                    ship.converting = false;
+                    continue;
+                }
+
+                int available = player.halite + ship.halite + m_halite[cell];
+                if (available < hlt::constants::DROPOFF_COST)
+                {
+                    ship.converting = false;
+                    continue;
+                }
+
+                player.halite = available - hlt::constants::DROPOFF_COST;
+                m_halite[cell] = 0;
+                m_structure_owner[cell] = player.id;
+                player.dropoffs.push_back({m_next_dropoff_id++, ship.position});
+                ++player.stats.dropoffs_built;
+
+                ship.halite = 0;
+                ship.destroyed = true;
+            }
+        }
+    }
+
+    // Cout de depart = halite de la cell / MOVE_COST_RATIO, sinon le ship reste sur place
+    void Simulator::process_moves()
+    {
+        for (auto &ship : m_ships)
+        {
+            if (ship.destroyed || ship.command == hlt::Direction::STILL)
+                continue;
+
+            int ratio = ship.inspired ? hlt::constants::INSPIRED_MOVE_COST_RATIO : hlt::constants::MOVE_COST_RATIO;
+            int cost = m_halite[index_of(ship.position)] / ratio;
+            if (ship.halite < cost)
+                continue;
+
+            ship.halite -= cost;
+            ship.position = normalize(ship.position.directional_offset(ship.command));
+            ship.moved = true;
+        }
+    }
+
+    void Simulator::process_spawns()
+    {
+        for (auto &player : m_players)
+        {
+            if (!player.wants_spawn || !player.alive || player.halite < hlt::constants::SHIP_COST)
+                continue;
+
+            player.halite -= hlt::constants::SHIP_COST;
+            ++player.stats.ships_built;
+
+            ShipState ship;
+            ship.id = m_next_ship_id++;
+            ship.owner = player.id;
+            ship.position = player.shipyard;
+            ship.halite = 0;
+            ship.inspired = false;
+            ship.command = hlt::Direction::STILL;
+            ship.converting = false;
+            ship.moved = true; // Pas d'extraction le tour du spawn
+            ship.destroyed = false;
+            m_ships.push_back(ship);
+        }
+    }
+
+    // Ships sur la meme cell detruits, cargo au proprietaire de la structure ou dans la mer
+    void Simulator::process_collisions()
+    {
+        for (const auto &ship : m_ships)
+            if (!ship.destroyed)
+                ++m_cell_count[index_of(ship.position)];
+
+        for (auto &ship : m_ships)
+        {
+            if (ship.destroyed)
+                continue;
+
+            size_t cell = index_of(ship.position);
+            if (m_cell_count[cell] < 2)
+                continue;
+
+            int owner = m_structure_owner[cell];
+            if (owner >= 0)
+                m_players[owner].halite += ship.halite;
+            else
+                m_halite[cell] += ship.halite;
+
+            ++m_players[ship.owner].stats.ships_lost;
+            ship.halite = 0;
+            ship.destroyed = true;
+        }
+
+        for (const auto &ship : m_ships)
+            m_cell_count[index_of(ship.position)] = 0;
+    }
+
+    // Extraction des ships restes sur place : 1/EXTRACT_RATIO arrondi au superieur, + bonus inspire
+    void Simulator::process_mining()
+    {
+        int max_halite = hlt::constants::MAX_HALITE;
+
+        for (auto &ship : m_ships)
+        {
+            if (ship.destroyed || ship.moved || ship.converting)
+                continue;
+
+            int &cell = m_halite[index_of(ship.position)];
+            int ratio = ship.inspired ? hlt::constants::INSPIRED_EXTRACT_RATIO : hlt::constants::EXTRACT_RATIO;
+            int extracted = (cell + ratio - 1) / ratio;
+            if (ship.halite + extracted > max_halite)
+                extracted = max_halite - ship.halite;
+
+            cell -= extracted;
+            ship.halite += extracted;
+
+            if (!ship.inspired)
+                continue;
+
+            int bonus = static_cast<int>(extracted * hlt::constants::INSPIRED_BONUS_MULTIPLIER);
+            ship.halite += std::min(bonus, max_halite - ship.halite);
+        }
+    }
+
+    void Simulator::process_deposits()
+    {
+        for (auto &ship : m_ships)
+        {
+            if (ship.destroyed || ship.halite == 0)
+                continue;
+
+            if (m_structure_owner[index_of(ship.position)] != ship.owner)
+                continue;
+
+            m_players[ship.owner].halite += ship.halite;
+            ship.halite = 0;
+        }
+    }
+
+    void Simulator::remove_destroyed_ships()
+    {
+        m_ships.erase(std::remove_if(m_ships.begin(), m_ships.end(),
+                                     [](const ShipState &ship)
+                                     { return ship.destroyed; }),
+                      m_ships.end());
+
+        m_ship_slot.assign(static_cast<size_t>(m_next_ship_id), -1);
+        for (size_t i = 0; i < m_ships.size(); ++i)
+            m_ship_slot[m_ships[i].id] = static_cast<int>(i);
+    }
+
+    // Elimine : plus de ship et pas de quoi en construire un
+    void Simulator::update_eliminations()
+    {
+        std::vector<int> ship_count(m_players.size(), 0);
+        for (const auto &ship : m_ships)
+            ++ship_count[ship.owner];
+
+        for (auto &player : m_players)
+        {
+            if (!player.alive || ship_count[player.id] > 0 || player.halite >= hlt::constants::SHIP_COST)
+                continue;
+
+            player.alive = false;
+            player.stats.eliminated_turn = m_turn;
+        }
+    }
+
+    // RESULTAT
+
+    GameResult Simulator::result() const
+    {
+        GameResult result;
+        result.config = m_config;
+        result.turns_played = std::min(m_turn - 1, m_max_turns);
+
+        for (const auto &player : m_players)
+        {
+            PlayerResult stats = player.stats;
+            stats.halite = player.halite;
+            result.players.push_back(stats);
+        }
+
+        // Survivants par halite, puis elimines du plus tardif au plus precoce
+        std::vector<PlayerResult> order = result.players;
+        std::stable_sort(order.begin(), order.end(),
+                         [](const PlayerResult &a, const PlayerResult &b)
+                         {
+                             bool a_alive = a.eliminated_turn < 0;
+                             bool b_alive = b.eliminated_turn < 0;
+                             if (a_alive != b_alive)
+                                 return a_alive;
+                             if (!a_alive)
+                                 return a.eliminated_turn > b.eliminated_turn;
+                             return a.halite > b.halite;
+                         });
+
+        for (size_t rank = 0; rank < order.size(); ++rank)
+            result.players[order[rank].id].rank = static_cast<int>(rank) + 1;
+
+        return result;
+    }
+} // namespace sim
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "map_generator.hpp"
+#include "hlt/types.hpp"
+#include "hlt/position.hpp"
+#include "hlt/direction.hpp"
+#include "hlt/command.hpp"
+#include "hlt/game.hpp"
+#include "HaliteAI/Bot/bot_player.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace sim
+{
+    /// Parametres d'une partie locale
+    struct GameConfig
+    {
+        int width = 32;
+        int height = 32;
+        int num_players = 2;  // 2 ou 4
+        uint64_t seed = 0;
+        int max_turns = 0;    // 0 : valeur officielle selon la taille de map
+    };
+
+    /// Bilan d'un joueur en fin de partie
+    struct PlayerResult
+    {
+        hlt::PlayerId id = 0;
+        int rank = 0;
+        int halite = 0;               // Halite stocke en fin de partie
+        int ships_built = 0;
+        int dropoffs_built = 0;
+        int ships_lost = 0;           // Ships detruits en collision
+        int eliminated_turn = -1;     // -1 si encore en vie a la fin
+        std::vector<float> turn_ms;   // Temps de calcul du bot par tour
+    };
+
+    struct GameResult
+    {
+        GameConfig config;
+        int turns_played = 0;
+        std::vector<PlayerResult> players;
+    };
+
+    /// Fabrique du bot d'un joueur, le hlt::Game fourni vit toute la partie
+    using BotFactory = std::function<std::unique_ptr<bot::BotPlayer>(hlt::Game &)>;
+
+    /// Remplit hlt::constants avec les valeurs officielles pour une taille de map.
+    /// hlt::constants est global : les parties jouees en parallele doivent partager la taille,
+    /// et l'appel ne reecrit rien si les valeurs sont deja en place
+    void set_default_constants(int map_width, int max_turns = 0);
+
+    /// Moteur des regles Halite III en memoire : mouvements, extraction, inspiration,
+    /// collisions, dropoffs, spawn et fin de partie, selon hlt::constants
+    class Simulator
+    {
+    public:
+        explicit Simulator(const GameConfig &config);
+
+        // Non-copiable
+        Simulator(const Simulator &) = delete;
+        Simulator &operator=(const Simulator &) = delete;
+
+        /// Joue une partie complete, bots[i] joue le joueur i
+        GameResult run(const std::vector<BotFactory> &bots);
+
+        // API pas a pas
+
+        /// Commandes d'un joueur pour le tour courant
+        void submit(hlt::PlayerId player_id, const std::vector<hlt::Command> &commands);
+
+        /// Resout le tour courant et passe au suivant
+        void step();
+
+        bool is_over() const;
+        int turn() const { return m_turn; }
+        int max_turns() const { return m_max_turns; }
+
+        /// Vue hlt::Game d'un joueur mise a jour avec l'etat courant
+        void sync_view(hlt::Game &view) const;
+
+        /// Cree la vue hlt::Game d'un joueur (map et joueurs du debut de partie)
+        std::unique_ptr<hlt::Game> make_view(hlt::PlayerId player_id) const;
+
+        /// Classement et compteurs des joueurs
+        GameResult result() const;
+
+    private:
+        struct ShipState
+        {
+            hlt::EntityId id;
+            hlt::PlayerId owner;
+            hlt::Position position;
+            int halite;
+            bool inspired;
+
+            // Etat du tour
+            hlt::Direction command;
+            bool converting;
+            bool moved;
+            bool destroyed;
+        };
+
+        struct DropoffState
+        {
+            hlt::EntityId id;
+            hlt::Position position;
+        };
+
+        struct PlayerState
+        {
+            hlt::PlayerId id;
+            hlt::Position shipyard;
+            int halite;
+            std::vector<DropoffState> dropoffs;
+            bool alive;
+            PlayerResult stats;
+
+            // Commandes du tour
+            bool wants_spawn;
+            std::vector<hlt::EntityId> constructs;
+        };
+
+        size_t index_of(const hlt::Position &pos) const
+        {
+            return static_cast<size_t>(pos.y) * m_width + pos.x;
+        }
+
+        hlt::Position normalize(const hlt::Position &pos) const
+        {
+            return {((pos.x % m_width) + m_width) % m_width, ((pos.y % m_height) + m_height) % m_height};
+        }
+
+        ShipState *find_ship(hlt::EntityId id, hlt::PlayerId owner);
+
+        void reset_commands();
+        void update_inspiration();
+        void process_constructs();
+        void process_moves();
+        void process_spawns();
+        void process_collisions();
+        void process_mining();
+        void process_deposits();
+        void remove_destroyed_ships();
+        void update_eliminations();
+
+        GameConfig m_config;
+        int m_width;
+        int m_height;
+        int m_turn;
+        int m_max_turns;
+        hlt::EntityId m_next_ship_id;
+        hlt::EntityId m_next_dropoff_id;
+
+        std::vector<int> m_halite;           // Halite par cell
+        std::vector<int> m_structure_owner;  // Owner du shipyard/dropoff de la cell, -1 sinon
+        std::vector<PlayerState> m_players;
+        std::vector<ShipState> m_ships;
+        std::vector<int> m_ship_slot;        // Ship id -> index dans m_ships, -1 si detruit
+        std::vector<int> m_cell_count;       // Scratch : ships par cell apres mouvement
+    };
+} // namespace sim
@@ -0,0 +1,267 @@
+#include "state_generator.hpp"
+#include "rng.hpp"
+#include "hlt/constants.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace sim
+{
+    namespace
+    {
+        constexpr int MAX_SHIP_HALITE = 1000;
+        constexpr int MIN_DROPOFF_SPACING = 6;
+        constexpr int DROPOFF_CANDIDATES = 32;
+        constexpr int PLACEMENT_ATTEMPTS = 256;
+
+        class Layout
+        {
+        public:
+            Layout(int width, int height, int num_players)
+                : m_width(width), m_height(height), m_num_players(num_players),
+                  m_occupied(static_cast<size_t>(width) * height, 0)
+            {
+            }
+
+            hlt::Position normalize(int x, int y) const
+            {
+                return hlt::Position(((x % m_width) + m_width) % m_width, ((y % m_height) + m_height) % m_height);
+            }
+
+            int distance(const hlt::Position &a, const hlt::Position &b) const
+            {
+                int dx = std::abs(a.x - b.x);
+                int dy = std::abs(a.y - b.y);
+                return std::min(dx, m_width - dx) + std::min(dy, m_height - dy);
+            }
+
+            size_t index_of(const hlt::Position &pos) const
+            {
+                return static_cast<size_t>(pos.y) * m_width + pos.x;
+            }
+
+            /// Images miroir de pos pour chaque joueur
+            std::vector<hlt::Position> mirrors(const hlt::Position &pos) const
+            {
+                std::vector<hlt::Position> images;
+                for (int i = 0; i < m_num_players; ++i)
+                    images.push_back(mirror_position(pos, i, m_width, m_height));
+                return images;
+            }
+
+            /// Vrai si toutes les images sont libres et distinctes
+            bool is_free(const std::vector<hlt::Position> &images) const
+            {
+                for (size_t i = 0; i < images.size(); ++i)
+                {
+                    if (m_occupied[index_of(images[i])])
+                        return false;
+                    for (size_t j = 0; j < i; ++j)
+                        if (images[i] == images[j])
+                            return false;
+                }
+                return true;
+            }
+
+            void occupy(const hlt::Position &pos) { m_occupied[index_of(pos)] = 1; }
+
+            /// Cell a distance dist de center (losange), direction tiree au hasard
+            hlt::Position random_at_distance(const hlt::Position &center, int dist, Rng &rng) const
+            {
+                int dx = rng.uniform_int(-dist, dist);
+                int dy = (dist - std::abs(dx)) * ((rng.next() & 1) ? 1 : -1);
+                return normalize(center.x + dx, center.y + dy);
+            }
+
+        private:
+            int m_width;
+            int m_height;
+            int m_num_players;
+            std::vector<char> m_occupied;
+        };
+
+        int local_halite(const GeneratedMap &map, const Layout &layout, const hlt::Position &center, int radius)
+        {
+            int total = 0;
+            for (int dy = -radius; dy <= radius; ++dy)
+            {
+                for (int dx = -radius; dx <= radius; ++dx)
+                {
+                    if (std::abs(dx) + std::abs(dy) > radius)
+                        continue;
+                    hlt::Position pos = layout.normalize(center.x + dx, center.y + dy);
+                    total += map.at(pos.x, pos.y);
+                }
+            }
+            return total;
+        }
+    } // namespace
+
+    GeneratedState generate_state(const StateConfig &config)
+    {
+        Rng rng(config.seed);
+
+        GeneratedState state;
+        state.config = config;
+        state.map = generate_map(config.width, config.height, config.num_players, rng.next());
+
+        GeneratedMap &map = state.map;
+        Layout layout(config.width, config.height, config.num_players);
+        double progress = std::min(1.0, std::max(0.0, config.progress));
+
+        int tile_w = config.width / 2;
+        int tile_h = (config.num_players == 4) ? config.height / 2 : config.height;
+        int tile_area = tile_w * tile_h;
+        int tile_span = std::min(tile_w, tile_h);
+
+        for (const auto &yard : map.shipyards)
+            layout.occupy(yard);
+
+        // Depots du joueur 0 : shipyard puis dropoffs sur les zones les plus riches
+        std::vector<hlt::Position> depots = {map.shipyards[0]};
+
+        int dropoff_count = config.dropoffs_per_player;
+        if (dropoff_count < 0)
+            dropoff_count = (progress < 0.25) ? 0 : std::max(1, static_cast<int>(progress * tile_area / 400));
+
+        hlt::EntityId next_dropoff_id = 0;
+        for (int d = 0; d < dropoff_count; ++d)
+        {
+            hlt::Position best;
+            int best_score = -1;
+            int max_dist = std::max(MIN_DROPOFF_SPACING + 1, tile_span * 3 / 4);
+
+            for (int c = 0; c < DROPOFF_CANDIDATES; ++c)
+            {
+                int dist = rng.uniform_int(MIN_DROPOFF_SPACING, max_dist);
+                hlt::Position pos = layout.random_at_distance(map.shipyards[0], dist, rng);
+                if (!layout.is_free(layout.mirrors(pos)))
+                    continue;
+
+                bool spaced = true;
+                for (const auto &depot : depots)
+                    spaced = spaced && layout.distance(pos, depot) >= MIN_DROPOFF_SPACING;
+                if (!spaced)
+                    continue;
+
+                int score = local_halite(map, layout, pos, 2);
+                if (score > best_score)
+                {
+                    best_score = score;
+                    best = pos;
+                }
+            }
+
+            if (best_score < 0)
+                break;
+
+            depots.push_back(best);
+            std::vector<hlt::Position> images = layout.mirrors(best);
+            for (int p = 0; p < config.num_players; ++p)
+            {
+                state.dropoffs.push_back({p, next_dropoff_id++, images[p]});
+                layout.occupy(images[p]);
+                map.halite[layout.index_of(images[p])] = 0;
+            }
+        }
+
+        // Extraction : plus forte pres des depots de chaque joueur, legere partout ailleurs
+        int depletion_radius = 4 + static_cast<int>(progress * tile_span * 0.6);
+        double depletion_strength = std::min(0.95, 1.2 * progress);
+        double global_keep = 1.0 - 0.25 * progress;
+
+        std::vector<hlt::Position> all_depots;
+        for (const auto &depot : depots)
+            for (const auto &image : layout.mirrors(depot))
+                all_depots.push_back(image);
+
+        for (int y = 0; y < config.height; ++y)
+        {
+            for (int x = 0; x < config.width; ++x)
+            {
+                hlt::Position pos(x, y);
+                double keep = global_keep;
+                for (const auto &depot : all_depots)
+                {
+                    int dist = layout.distance(pos, depot);
+                    if (dist < depletion_radius)
+                        keep *= 1.0 - depletion_strength * (1.0 - static_cast<double>(dist) / depletion_radius);
+                }
+
+                int &halite = map.halite[layout.index_of(pos)];
+                halite = static_cast<int>(halite * keep);
+            }
+        }
+
+        // Flotte : autour des depots, cargo selon que le ship mine ou rentre
+        int ship_count = config.ships_per_player;
+        if (ship_count < 0)
+            ship_count = std::max(1, static_cast<int>(tile_area / 40.0 * std::min(1.0, progress * 3.0)));
+
+        int spread = depletion_radius + 4;
+        hlt::EntityId next_ship_id = 0;
+        for (int s = 0; s < ship_count; ++s)
+        {
+            bool placed = false;
+            std::vector<hlt::Position> images;
+
+            for (int attempt = 0; attempt < PLACEMENT_ATTEMPTS && !placed; ++attempt)
+            {
+                const hlt::Position &anchor = depots[static_cast<size_t>(rng.uniform_int(0, static_cast<int>(depots.size()) - 1))];
+                int dist = rng.uniform_int(1, spread + attempt / 16);
+                images = layout.mirrors(layout.random_at_distance(anchor, dist, rng));
+                placed = layout.is_free(images);
+            }
+
+            if (!placed)
+                break;
+
+            int cargo = (rng.uniform() < 0.25) ? rng.uniform_int(600, MAX_SHIP_HALITE) : rng.uniform_int(0, 500);
+            double mined_keep = 0.3 + 0.7 * rng.uniform();
+
+            for (int p = 0; p < config.num_players; ++p)
+            {
+                state.ships.push_back({p, next_ship_id++, images[p], cargo});
+                layout.occupy(images[p]);
+
+                int &halite = map.halite[layout.index_of(images[p])];
+                halite = static_cast<int>(halite * mined_keep);
+            }
+        }
+
+        int bank = 1000 + rng.uniform_int(0, static_cast<int>(6000 * progress));
+        state.player_halite.assign(static_cast<size_t>(config.num_players), bank);
+
+        return state;
+    }
+
+    std::unique_ptr<hlt::Game> make_game(const GeneratedState &state, hlt::PlayerId player_id)
+    {
+        const GeneratedMap &map = state.map;
+
+        std::vector<std::shared_ptr<hlt::Player>> players;
+        for (int i = 0; i < state.config.num_players; ++i)
+        {
+            auto player = std::make_shared<hlt::Player>(i, map.shipyards[i].x, map.shipyards[i].y);
+            player->halite = state.player_halite[i];
+            players.push_back(player);
+        }
+
+        for (const auto &ship : state.ships)
+            players[ship.owner]->ships.add(
+                hlt::Ship(ship.owner, ship.id, ship.position.x, ship.position.y, ship.halite));
+
+        for (const auto &dropoff : state.dropoffs)
+            players[dropoff.owner]->dropoffs.add(
+                hlt::Dropoff(dropoff.owner, dropoff.id, dropoff.position.x, dropoff.position.y));
+
+        std::unique_ptr<hlt::Game> game = std::make_unique<hlt::Game>(
+            player_id, players, make_game_map(map.width, map.height, map.halite));
+
+        double progress = std::min(1.0, std::max(0.0, state.config.progress));
+        game->turn_number = 1 + static_cast<int>(progress * (hlt::constants::MAX_TURNS - 1));
+        game->_sync_entities();
+        return game;
+    }
+} // namespace sim
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "map_generator.hpp"
+#include "hlt/types.hpp"
+#include "hlt/position.hpp"
+#include "hlt/game.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sim
+{
+    /// Parametres d'un etat de partie synthetique
+    struct StateConfig
+    {
+        int width = 32;
+        int height = 32;
+        int num_players = 2;          // 2 ou 4
+        uint64_t seed = 0;
+        double progress = 0.5;        // Avancement de la partie : 0 debut, 1 dernier tour
+        int ships_per_player = -1;    // -1 : selon la taille de map et l'avancement
+        int dropoffs_per_player = -1; // -1 : selon la taille de map et l'avancement
+    };
+
+    struct GeneratedShip
+    {
+        hlt::PlayerId owner;
+        hlt::EntityId id;
+        hlt::Position position;
+        int halite;
+    };
+
+    struct GeneratedDropoff
+    {
+        hlt::PlayerId owner;
+        hlt::EntityId id;
+        hlt::Position position;
+    };
+
+    /// Etat de mi-partie : map deja minee autour des depots et des ships, flottes et cargos.
+    /// Chaque joueur recoit l'image miroir de la disposition du joueur 0
+    struct GeneratedState
+    {
+        StateConfig config;
+        GeneratedMap map;             // Halite restant, shipyards
+        std::vector<GeneratedShip> ships;
+        std::vector<GeneratedDropoff> dropoffs;
+        std::vector<int> player_halite;
+    };
+
+    /// Etat symetrique deterministe pour une seed donnee. Si la map est trop pleine,
+    /// un joueur peut recevoir moins de ships que demande (meme nombre pour tous)
+    GeneratedState generate_state(const StateConfig &config);
+
+    /// Vue hlt::Game du joueur player_id, tour deduit de l'avancement et de hlt::constants::MAX_TURNS
+    std::unique_ptr<hlt::Game> make_game(const GeneratedState &state, hlt::PlayerId player_id);
+} // namespace sim
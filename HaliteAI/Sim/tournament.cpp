@@ -0,0 +1,155 @@
+#include "tournament.hpp"
+#include "rng.hpp"
+#include "HaliteAI/Bot/thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace sim
+{
+    namespace
+    {
+        struct GameJob
+        {
+            GameConfig config;
+            size_t candidate_seat;
+            size_t format;
+            PlayerResult result;
+        };
+
+        float percentile(const std::vector<float> &sorted, double p)
+        {
+            if (sorted.empty())
+                return 0.0f;
+            size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+            return sorted[std::min(index, sorted.size() - 1)];
+        }
+
+        void write_row(const char *label, const FormatSummary &row, std::ostream &out)
+        {
+            std::vector<float> sorted = row.turn_ms;
+            std::sort(sorted.begin(), sorted.end());
+
+            double games = std::max(1, row.games);
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-10s %6d %8.3f %9.2f %9.0f %7.1f %9.3f %9.3f %9.3f\n", label,
+                          row.games, row.wins / games, row.rank_sum / games, row.halite_sum / games,
+                          row.ships_built_sum / games, percentile(sorted, 0.50), percentile(sorted, 0.99),
+                          sorted.empty() ? 0.0f : sorted.back());
+            out << line;
+        }
+    } // namespace
+
+    BotFactory make_bot_factory(const bot::BotParams &params)
+    {
+        return [params](hlt::Game &game) {
+            return std::unique_ptr<bot::BotPlayer>(new bot::BotPlayer(game, params, 0));
+        };
+    }
+
+    PlayerResult play_seat(const GameConfig &config, size_t candidate_seat, const BotFactory &candidate,
+                           const BotFactory &opponent)
+    {
+        std::vector<BotFactory> bots(static_cast<size_t>(config.num_players), opponent);
+        bots[candidate_seat] = candidate;
+
+        Simulator simulator(config);
+        return simulator.run(bots).players[candidate_seat];
+    }
+
+    void FormatSummary::add(const PlayerResult &result)
+    {
+        ++games;
+        if (result.rank == 1)
+            ++wins;
+        rank_sum += result.rank;
+        halite_sum += result.halite;
+        ships_built_sum += result.ships_built;
+        turn_ms.insert(turn_ms.end(), result.turn_ms.begin(), result.turn_ms.end());
+    }
+
+    void FormatSummary::merge(const FormatSummary &other)
+    {
+        games += other.games;
+        wins += other.wins;
+        rank_sum += other.rank_sum;
+        halite_sum += other.halite_sum;
+        ships_built_sum += other.ships_built_sum;
+        turn_ms.insert(turn_ms.end(), other.turn_ms.begin(), other.turn_ms.end());
+    }
+
+    TournamentSummary run_tournament(const TournamentConfig &config, const BotFactory &candidate,
+                                     const BotFactory &opponent)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        TournamentSummary summary;
+        summary.config = config;
+
+        size_t threads = config.threads > 0 ? config.threads
+                                            : std::max<size_t>(1, std::thread::hardware_concurrency());
+        bot::ThreadPool pool(threads - 1);
+
+        Rng seeds(config.seed);
+
+        for (int size : config.map_sizes)
+        {
+            // Une taille a la fois : toutes les parties du lot partagent hlt::constants
+            set_default_constants(size);
+
+            std::vector<GameJob> jobs;
+            for (int players : config.player_counts)
+            {
+                size_t format = summary.formats.size();
+                summary.formats.emplace_back();
+                summary.formats.back().map_size = size;
+                summary.formats.back().num_players = players;
+
+                for (int g = 0; g < config.games_per_format; ++g)
+                {
+                    GameJob job;
+                    job.config.width = size;
+                    job.config.height = size;
+                    job.config.num_players = players;
+                    job.config.seed = seeds.next();
+                    job.candidate_seat = static_cast<size_t>(g % players);
+                    job.format = format;
+                    jobs.push_back(job);
+                }
+            }
+
+            pool.parallel_for(jobs.size(), [&](size_t i) {
+                GameJob &job = jobs[i];
+                job.result = play_seat(job.config, job.candidate_seat, candidate, opponent);
+            });
+
+            // Agregation dans l'ordre des jobs : resume identique quel que soit le nombre de threads
+            for (const auto &job : jobs)
+                summary.formats[job.format].add(job.result);
+        }
+
+        for (const auto &format : summary.formats)
+            summary.total.merge(format);
+
+        summary.wall_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return summary;
+    }
+
+    void write_summary(const TournamentSummary &summary, std::ostream &out)
+    {
+        out << "# Tournoi : " << summary.total.games << " parties, seed " << summary.config.seed << ", "
+            << summary.wall_seconds << " s\n";
+        out << "format      games  winrate mean_rank    halite   ships   p50_ms    p99_ms    max_ms\n";
+
+        char label[32];
+        for (const auto &format : summary.formats)
+        {
+            std::snprintf(label, sizeof(label), "%dx%d-%dp", format.map_size, format.map_size, format.num_players);
+            write_row(label, format, out);
+        }
+        write_row("total", summary.total, out);
+    }
+} // namespace sim
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "simulator.hpp"
+#include "HaliteAI/Bot/bot_params.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace sim
+{
+    /// Parametres d'un tournoi de self-play
+    struct TournamentConfig
+    {
+        std::vector<int> map_sizes{32, 40, 48, 56, 64};
+        std::vector<int> player_counts{2, 4};
+        int games_per_format = 10;  // Parties par couple (taille, joueurs)
+        uint64_t seed = 1;
+        size_t threads = 0;         // 0 : tous les coeurs
+    };
+
+    /// Stats du candidat agregees sur un format (ou sur tout le tournoi)
+    struct FormatSummary
+    {
+        int map_size = 0;           // 0 pour le total
+        int num_players = 0;
+        int games = 0;
+        int wins = 0;
+        long long rank_sum = 0;
+        long long halite_sum = 0;
+        long long ships_built_sum = 0;
+        std::vector<float> turn_ms; // Temps de calcul du candidat, tous tours confondus
+
+        void add(const PlayerResult &result);
+        void merge(const FormatSummary &other);
+    };
+
+    struct TournamentSummary
+    {
+        TournamentConfig config;
+        std::vector<FormatSummary> formats;
+        FormatSummary total;
+        double wall_seconds = 0.0;
+    };
+
+    /// Fabrique de BotPlayer sans thread de decision (une partie par thread)
+    BotFactory make_bot_factory(const bot::BotParams &params);
+
+    /// Joue une partie, candidate au siege candidate_seat et opponent aux autres.
+    /// Retourne le bilan du candidat
+    PlayerResult play_seat(const GameConfig &config, size_t candidate_seat, const BotFactory &candidate,
+                           const BotFactory &opponent);
+
+    /// Joue games_per_format parties par format, candidat contre des adversaires.
+    /// Le siege du candidat tourne d'une partie a l'autre pour annuler l'avantage de position.
+    /// Les parties d'une meme taille de map tournent en parallele (hlt::constants est global),
+    /// les bots produits par les fabriques doivent donc etre sans thread de decision.
+    TournamentSummary run_tournament(const TournamentConfig &config, const BotFactory &candidate,
+                                     const BotFactory &opponent);
+
+    /// Tableau resume : win rate, rang moyen, halite, ships construits, latence p50/p99/max
+    void write_summary(const TournamentSummary &summary, std::ostream &out);
+} // namespace sim
@@ -0,0 +1,149 @@
+#include "tuner.hpp"
+#include "tournament.hpp"
+#include "rng.hpp"
+#include "HaliteAI/Bot/thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace sim
+{
+    namespace
+    {
+        struct Candidate
+        {
+            bot::BotParams params;
+            double points = 0.0;
+            long long halite = 0;
+            int games = 0;
+
+            double score() const { return games > 0 ? points / games : 0.0; }
+        };
+
+        struct TunerJob
+        {
+            size_t candidate;
+            GameConfig config;
+            size_t seat;
+            PlayerResult result;
+        };
+
+        // Normale centree reduite (Box-Muller)
+        double gaussian(Rng &rng)
+        {
+            double u1 = std::max(rng.uniform(), 1e-12);
+            double u2 = rng.uniform();
+            return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+        }
+
+        bot::BotParams mutate(const bot::BotParams &base, double scale, Rng &rng)
+        {
+            bot::BotParams params = base;
+            for (const auto &spec : bot::param_specs())
+            {
+                if (!spec.tunable)
+                    continue;
+
+                double range = spec.max_value - spec.min_value;
+                double value = spec.get(base) + gaussian(rng) * scale * range;
+                spec.set(params, std::min(spec.max_value, std::max(spec.min_value, value)));
+            }
+            return params;
+        }
+    } // namespace
+
+    TunerResult tune(const TunerConfig &config, const bot::BotParams &base)
+    {
+        Rng rng(config.seed);
+
+        // Candidat 0 = base : un mutant doit faire mieux pour la remplacer
+        std::vector<Candidate> candidates(static_cast<size_t>(std::max(1, config.candidates)));
+        candidates[0].params = base;
+        for (size_t i = 1; i < candidates.size(); ++i)
+            candidates[i].params = mutate(base, config.mutation_scale, rng);
+
+        std::vector<size_t> alive(candidates.size());
+        for (size_t i = 0; i < alive.size(); ++i)
+            alive[i] = i;
+
+        size_t threads = config.threads > 0 ? config.threads
+                                            : std::max<size_t>(1, std::thread::hardware_concurrency());
+        bot::ThreadPool pool(threads - 1);
+
+        set_default_constants(config.map_size);
+        BotFactory opponent = make_bot_factory(base);
+
+        int games = std::max(1, config.initial_games);
+        for (;;)
+        {
+            // Memes seeds et sieges pour tous les candidats du tour : seule la variante change
+            std::vector<GameConfig> games_config(static_cast<size_t>(games));
+            for (auto &game : games_config)
+            {
+                game.width = config.map_size;
+                game.height = config.map_size;
+                game.num_players = config.num_players;
+                game.seed = rng.next();
+            }
+
+            std::vector<TunerJob> jobs;
+            for (size_t c : alive)
+            {
+                for (int g = 0; g < games; ++g)
+                {
+                    TunerJob job;
+                    job.candidate = c;
+                    job.config = games_config[static_cast<size_t>(g)];
+                    job.seat = static_cast<size_t>(g % config.num_players);
+                    jobs.push_back(job);
+                }
+            }
+
+            pool.parallel_for(jobs.size(), [&](size_t i) {
+                TunerJob &job = jobs[i];
+                job.result = play_seat(job.config, job.seat, make_bot_factory(candidates[job.candidate].params),
+                                       opponent);
+            });
+
+            for (const auto &job : jobs)
+            {
+                Candidate &candidate = candidates[job.candidate];
+                candidate.points += static_cast<double>(config.num_players - job.result.rank) /
+                                    std::max(1, config.num_players - 1);
+                candidate.halite += job.result.halite;
+                ++candidate.games;
+            }
+
+            // Tri par score puis halite moyen, la base gagne les egalites (index le plus bas)
+            std::stable_sort(alive.begin(), alive.end(), [&](size_t a, size_t b) {
+                const Candidate &ca = candidates[a];
+                const Candidate &cb = candidates[b];
+                if (ca.score() != cb.score())
+                    return ca.score() > cb.score();
+                return ca.halite * cb.games > cb.halite * ca.games;
+            });
+
+            if (alive.size() == 1)
+                break;
+
+            alive.resize((alive.size() + 1) / 2);
+            games *= 2;
+        }
+
+        // Contre la base, 0.5 est la parite : un gagnant en dessous ne l'a pas battue
+        size_t winner = alive.front();
+        if (candidates[winner].score() < 0.5)
+            winner = 0;
+
+        const Candidate &best = candidates[winner];
+
+        TunerResult result;
+        result.params = best.params;
+        result.score = best.score();
+        result.games = best.games;
+        result.is_base = winner == 0;
+        return result;
+    }
+} // namespace sim
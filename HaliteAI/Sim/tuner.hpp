@@ -0,0 +1,35 @@
+#pragma once
+
+#include "HaliteAI/Bot/bot_params.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sim
+{
+    /// Parametres du tuner (successive halving) pour un format de partie
+    struct TunerConfig
+    {
+        int map_size = 32;
+        int num_players = 2;
+        int candidates = 16;          // Population initiale, base comprise
+        int initial_games = 4;        // Parties par candidat au premier tour, doublees ensuite
+        double mutation_scale = 0.15; // Ecart-type d'une mutation, relatif a la plage du param
+        uint64_t seed = 1;
+        size_t threads = 0;           // 0 : tous les coeurs
+    };
+
+    struct TunerResult
+    {
+        bot::BotParams params;
+        double score = 0.0;   // Points moyens : 1 premier, 0 dernier
+        int games = 0;        // Parties jouees par le gagnant
+        bool is_base = false; // Aucun mutant n'a battu la base
+    };
+
+    /// Successive halving : des mutants de base jouent contre base sur les memes seeds,
+    /// la moitie la moins bien classee est eliminee a chaque tour et les survivants
+    /// jouent deux fois plus de parties, jusqu'a un seul candidat.
+    /// Les parties d'un tour tournent en parallele.
+    TunerResult tune(const TunerConfig &config, const bot::BotParams &base);
+} // namespace sim
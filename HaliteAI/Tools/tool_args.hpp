@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tools
+{
+    /// "32,40,48" -> {32, 40, 48}
+    inline std::vector<int> parse_int_list(const char *arg)
+    {
+        std::vector<int> values;
+        std::stringstream stream(arg);
+        std::string item;
+        while (std::getline(stream, item, ','))
+            values.push_back(std::atoi(item.c_str()));
+        return values;
+    }
+} // namespace tools
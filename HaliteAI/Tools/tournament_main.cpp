@@ -0,0 +1,69 @@
+#include "HaliteAI/Sim/tournament.hpp"
+#include "tool_args.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void usage()
+    {
+        std::cerr << "Usage: Tournament [--games N] [--sizes 32,40,...] [--players 2,4] [--seed S]\n"
+                     "                  [--threads T] [--out fichier] [--params fichier] [--baseline fichier]\n";
+    }
+} // namespace
+
+// Self-play : le bot courant (--params) contre la reference (--baseline) sur des parties seedees,
+// resume dans un fichier. Sans fichier, les deux jouent les valeurs compilees
+int main(int argc, char *argv[])
+{
+    sim::TournamentConfig config;
+    std::string out_path = "tournament_summary.txt";
+    bot::BotParams candidate_params;
+    bot::BotParams baseline_params;
+    bool params_ok = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--games") == 0 && has_value)
+            config.games_per_format = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--sizes") == 0 && has_value)
+            config.map_sizes = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--players") == 0 && has_value)
+            config.player_counts = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && has_value)
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--threads") == 0 && has_value)
+            config.threads = static_cast<size_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--out") == 0 && has_value)
+            out_path = argv[++i];
+        else if (std::strcmp(argv[i], "--params") == 0 && has_value)
+            params_ok = candidate_params.load(argv[++i]) && params_ok;
+        else if (std::strcmp(argv[i], "--baseline") == 0 && has_value)
+            params_ok = baseline_params.load(argv[++i]) && params_ok;
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    if (!params_ok)
+    {
+        std::cerr << "Fichier de params absent ou invalide\n";
+        return 1;
+    }
+
+    sim::TournamentSummary summary = sim::run_tournament(config, sim::make_bot_factory(candidate_params),
+                                                         sim::make_bot_factory(baseline_params));
+
+    std::ofstream out(out_path);
+    sim::write_summary(summary, out);
+    sim::write_summary(summary, std::cout);
+
+    return out ? 0 : 1;
+}
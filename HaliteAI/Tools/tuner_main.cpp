@@ -0,0 +1,89 @@
+#include "HaliteAI/Sim/tuner.hpp"
+#include "tool_args.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void usage()
+    {
+        std::cerr << "Usage: Tuner [--sizes 32,48,64] [--players 2,4] [--candidates N] [--games N]\n"
+                     "             [--scale S] [--seed S] [--threads T] [--base fichier] [--out-dir dossier]\n";
+    }
+} // namespace
+
+// Regle BotParams pour chaque format (taille, joueurs) et ecrit un fichier de params par format,
+// lisible par MyBot (dossier en argument) et Tournament (--params)
+int main(int argc, char *argv[])
+{
+    sim::TunerConfig config;
+    std::vector<int> sizes{32, 40, 48, 56, 64};
+    std::vector<int> players{2, 4};
+    std::string out_dir = ".";
+    bot::BotParams base;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--sizes") == 0 && has_value)
+            sizes = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--players") == 0 && has_value)
+            players = tools::parse_int_list(argv[++i]);
+        else if (std::strcmp(argv[i], "--candidates") == 0 && has_value)
+            config.candidates = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--games") == 0 && has_value)
+            config.initial_games = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--scale") == 0 && has_value)
+            config.mutation_scale = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && has_value)
+            config.seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (std::strcmp(argv[i], "--threads") == 0 && has_value)
+            config.threads = static_cast<size_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--base") == 0 && has_value)
+        {
+            if (!base.load(argv[++i]))
+            {
+                std::cerr << "Fichier de params absent ou invalide : " << argv[i] << "\n";
+                return 1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--out-dir") == 0 && has_value)
+            out_dir = argv[++i];
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    for (int size : sizes)
+    {
+        for (int count : players)
+        {
+            config.map_size = size;
+            config.num_players = count;
+            sim::TunerResult result = sim::tune(config, base);
+
+            std::string path = out_dir + "/" + bot::params_file_name(size, size, count);
+            std::ofstream out(path);
+            out << "# " << size << "x" << size << " " << count << "p : score " << result.score << " sur "
+                << result.games << " parties" << (result.is_base ? " (base conservee)" : "") << "\n";
+            result.params.write(out);
+
+            if (!out)
+            {
+                std::cerr << "Ecriture impossible : " << path << "\n";
+                return 1;
+            }
+
+            std::cout << path << " : score " << result.score << " sur " << result.games << " parties"
+                      << (result.is_base ? " (base conservee)" : "") << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -1,12 +1,37 @@
 #include "hlt/game.hpp"
+#include "hlt/log.hpp"
 #include "HaliteAI/Bot/bot_player.hpp"
+#include "HaliteAI/Bot/bot_params.hpp"
+
+#include <string>
 
 int main(int argc, char *argv[])
 {
     hlt::Game game;
+
+    // Params du format (taille de map, nombre de joueurs) si un dossier est passe en argument
+    bot::BotParams params;
+    if (argc > 1)
+    {
+        std::string path = std::string(argv[1]) + "/" +
+                           bot::params_file_name(game.game_map->width, game.game_map->height,
+                                                 static_cast<int>(game.players.size()));
+        // Fichier charge a part : un fichier invalide laisse tous les defauts compiles
+        bot::BotParams loaded;
+        if (loaded.load(path))
+        {
+            params = loaded;
+            hlt::log::log("Params charges : " + path);
+        }
+        else
+        {
+            hlt::log::log("Params absents ou invalides, defauts compiles : " + path);
+        }
+    }
+
     game.ready("LaTortIA");
 
-    bot::BotPlayer player(game);
+    bot::BotPlayer player(game, params);
 
     for (;;)
     {
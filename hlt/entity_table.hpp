@@ -0,0 +1,75 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace hlt {
+    // Entities of one kind for the current turn, stored by value in a dense array.
+    // Ids are small increasing integers, so the id -> index lookup is a plain array too.
+    template <class T>
+    class EntityTable {
+    public:
+        static constexpr int NO_INDEX = -1;
+
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        // Keeps the storage, only forgets the entities of the previous turn.
+        void clear() {
+            for (const auto& entity : entities) {
+                index_of_id[static_cast<size_t>(entity.id)] = NO_INDEX;
+            }
+            entities.clear();
+        }
+
+        T& add(const T& entity) {
+            size_t id = static_cast<size_t>(entity.id);
+            if (id >= index_of_id.size()) {
+                index_of_id.resize(id + 1 > 2 * index_of_id.size() ? id + 1 : 2 * index_of_id.size(), NO_INDEX);
+            }
+            index_of_id[id] = static_cast<int>(entities.size());
+            entities.push_back(entity);
+            return entities.back();
+        }
+
+        // Index of the entity in the table, NO_INDEX if it is not there this turn.
+        int index_of(EntityId id) const {
+            if (id < 0 || static_cast<size_t>(id) >= index_of_id.size()) {
+                return NO_INDEX;
+            }
+            return index_of_id[static_cast<size_t>(id)];
+        }
+
+        T* find(EntityId id) {
+            int index = index_of(id);
+            return index == NO_INDEX ? nullptr : &entities[static_cast<size_t>(index)];
+        }
+
+        const T* find(EntityId id) const {
+            int index = index_of(id);
+            return index == NO_INDEX ? nullptr : &entities[static_cast<size_t>(index)];
+        }
+
+        bool contains(EntityId id) const { return index_of(id) != NO_INDEX; }
+
+        T& operator[](size_t index) { return entities[index]; }
+        const T& operator[](size_t index) const { return entities[index]; }
+
+        size_t size() const { return entities.size(); }
+        bool empty() const { return entities.empty(); }
+
+        iterator begin() { return entities.begin(); }
+        iterator end() { return entities.end(); }
+        const_iterator begin() const { return entities.begin(); }
+        const_iterator end() const { return entities.end(); }
+
+    private:
+        std::vector<T> entities;
+        std::vector<int> index_of_id;
+    };
+
+    template <class T>
+    constexpr int EntityTable<T>::NO_INDEX;
+}
@@ -21,6 +21,15 @@ hlt::Game::Game() : turn_number(0) {
     game_map = GameMap::_generate();
 }
 
+hlt::Game::Game(PlayerId my_id, std::vector<std::shared_ptr<Player>> players, std::unique_ptr<GameMap> game_map) :
+    turn_number(0),
+    my_id(my_id),
+    players(std::move(players)),
+    game_map(std::move(game_map))
+{
+    me = this->players[my_id];
+}
+
 void hlt::Game::ready(const std::string& name) {
     std::cout << name << std::endl;
 }
@@ -41,17 +50,19 @@ void hlt::Game::update_frame() {
 
     game_map->_update();
 
+    _sync_entities();
+}
+
+void hlt::Game::_sync_entities() {
     for (const auto& player : players) {
-        for (auto& ship_iterator : player->ships) {
-            auto ship = ship_iterator.second;
+        for (const auto& ship : player->ships) {
             game_map->at(ship)->mark_unsafe(ship);
         }
 
-        game_map->at(player->shipyard)->structure = player->shipyard;
+        game_map->at(player->shipyard)->set_structure(player->shipyard);
 
-        for (auto& dropoff_iterator : player->dropoffs) {
-            auto dropoff = dropoff_iterator.second;
-            game_map->at(dropoff)->structure = dropoff;
+        for (const auto& dropoff : player->dropoffs) {
+            game_map->at(dropoff)->set_structure(dropoff);
         }
     }
 }
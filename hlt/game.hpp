@@ -16,8 +16,13 @@ namespace hlt {
         std::unique_ptr<GameMap> game_map;
 
         Game();
+        // Builds a game without the engine connection (local simulation).
+        Game(PlayerId my_id, std::vector<std::shared_ptr<Player>> players, std::unique_ptr<GameMap> game_map);
         void ready(const std::string& name);
         void update_frame();
         bool end_turn(const std::vector<Command>& commands);
+
+        // Marks ships and structures on the map cells, once players and map are up to date.
+        void _sync_entities();
     };
 }
@@ -4,7 +4,7 @@
 void hlt::GameMap::_update() {
     for (int y = 0; y < height; ++y) {
         for (int x = 0; x < width; ++x) {
-            cells[y][x].ship.reset();
+            cells[y][x].clear_ship();
         }
     }
 
@@ -3,6 +3,7 @@
 #include "types.hpp"
 #include "map_cell.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace hlt {
@@ -24,10 +25,6 @@ namespace hlt {
             return at(entity->position);
         }
 
-        MapCell* at(const std::shared_ptr<Entity>& entity) {
-            return at(entity->position);
-        }
-
         int calculate_distance(const Position& source, const Position& target) {
             const auto& normalized_source = normalize(source);
             const auto& normalized_target = normalize(target);
@@ -47,7 +44,8 @@ namespace hlt {
             return { x, y };
         }
 
-        std::vector<Direction> get_unsafe_moves(const Position& source, const Position& destination) {
+        // Writes the (at most 2) directions that get closer to destination into out, returns how many.
+        int get_unsafe_moves(const Position& source, const Position& destination, Direction out[2]) {
             const auto& normalized_source = normalize(source);
             const auto& normalized_destination = normalize(destination);
 
@@ -56,30 +54,38 @@ namespace hlt {
             const int wrapped_dx = width - dx;
             const int wrapped_dy = height - dy;
 
-            std::vector<Direction> possible_moves;
+            int count = 0;
 
             if (normalized_source.x < normalized_destination.x) {
-                possible_moves.push_back(dx > wrapped_dx ? Direction::WEST : Direction::EAST);
+                out[count++] = dx > wrapped_dx ? Direction::WEST : Direction::EAST;
             } else if (normalized_source.x > normalized_destination.x) {
-                possible_moves.push_back(dx < wrapped_dx ? Direction::WEST : Direction::EAST);
+                out[count++] = dx < wrapped_dx ? Direction::WEST : Direction::EAST;
             }
 
             if (normalized_source.y < normalized_destination.y) {
-                possible_moves.push_back(dy > wrapped_dy ? Direction::NORTH : Direction::SOUTH);
+                out[count++] = dy > wrapped_dy ? Direction::NORTH : Direction::SOUTH;
             } else if (normalized_source.y > normalized_destination.y) {
-                possible_moves.push_back(dy < wrapped_dy ? Direction::NORTH : Direction::SOUTH);
+                out[count++] = dy < wrapped_dy ? Direction::NORTH : Direction::SOUTH;
             }
 
-            return possible_moves;
+            return count;
+        }
+
+        std::vector<Direction> get_unsafe_moves(const Position& source, const Position& destination) {
+            Direction moves[2];
+            const int count = get_unsafe_moves(source, destination, moves);
+            return std::vector<Direction>(moves, moves + count);
         }
 
-        Direction naive_navigate(std::shared_ptr<Ship> ship, const Position& destination) {
+        Direction naive_navigate(const Ship& ship, const Position& destination) {
             // get_unsafe_moves normalizes for us
-            for (auto direction : get_unsafe_moves(ship->position, destination)) {
-                Position target_pos = ship->position.directional_offset(direction);
+            Direction moves[2];
+            const int count = get_unsafe_moves(ship.position, destination, moves);
+            for (int i = 0; i < count; ++i) {
+                Position target_pos = ship.position.directional_offset(moves[i]);
                 if (!at(target_pos)->is_occupied()) {
                     at(target_pos)->mark_unsafe(ship);
-                    return direction;
+                    return moves[i];
                 }
             }
 
@@ -4,11 +4,13 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
+#include <atomic>
 
 static std::ofstream log_file;
 static std::vector<std::string> log_buffer;
 static bool has_opened = false;
 static bool has_atexit = false;
+static std::atomic<bool> is_enabled(true);
 
 void dump_buffer_at_exit() {
     if (has_opened) {
@@ -39,7 +41,18 @@ void hlt::log::open(int bot_id) {
     log_buffer.clear();
 }
 
+void hlt::log::set_enabled(bool enabled) {
+    is_enabled = enabled;
+}
+
+bool hlt::log::enabled() {
+    return is_enabled;
+}
+
 void hlt::log::log(const std::string& message) {
+    if (!is_enabled) {
+        return;
+    }
     if (has_opened) {
         log_file << message << std::endl;
     } else {
@@ -6,5 +6,9 @@ namespace hlt {
     namespace log {
         void open(int bot_id);
         void log(const std::string& message);
+        // Drops every message when disabled (many bots in one process).
+        void set_enabled(bool enabled);
+        // Lets callers skip building a message that would be dropped.
+        bool enabled();
     }
 }
@@ -9,8 +9,11 @@ namespace hlt {
     struct MapCell {
         Position position;
         Halite halite;
-        std::shared_ptr<Ship> ship;
-        std::shared_ptr<Entity> structure; // only has dropoffs and shipyards; if id is -1, then it's a shipyard, otherwise it's a dropoff
+        // Entities are referenced by owner and id, looked up in the owner's tables.
+        PlayerId ship_owner = -1; // -1 if there is no ship
+        EntityId ship_id = -1;
+        PlayerId structure_owner = -1; // -1 if there is no structure
+        EntityId structure_id = -1;    // only has dropoffs and shipyards; if id is -1, then it's a shipyard, otherwise it's a dropoff
 
         MapCell(int x, int y, Halite halite) :
             position(x, y),
@@ -18,19 +21,30 @@ namespace hlt {
         {}
 
         bool is_empty() const {
-            return !ship && !structure;
+            return !is_occupied() && !has_structure();
         }
 
         bool is_occupied() const {
-            return static_cast<bool>(ship);
+            return ship_owner >= 0;
         }
 
         bool has_structure() const {
-            return static_cast<bool>(structure);
+            return structure_owner >= 0;
         }
 
-        void mark_unsafe(std::shared_ptr<Ship>& ship) {
-            this->ship = ship;
+        void mark_unsafe(const Ship& ship) {
+            ship_owner = ship.owner;
+            ship_id = ship.id;
+        }
+
+        void clear_ship() {
+            ship_owner = -1;
+            ship_id = -1;
+        }
+
+        void set_structure(const Entity& structure) {
+            structure_owner = structure.owner;
+            structure_id = structure.id;
         }
     };
 }
@@ -4,21 +4,21 @@
 #include "shipyard.hpp"
 #include "ship.hpp"
 #include "dropoff.hpp"
+#include "entity_table.hpp"
 
 #include <memory>
-#include <unordered_map>
 
 namespace hlt {
     struct Player {
         PlayerId id;
-        std::shared_ptr<Shipyard> shipyard;
+        Shipyard shipyard;
         Halite halite;
-        std::unordered_map<EntityId, std::shared_ptr<Ship>> ships;
-        std::unordered_map<EntityId, std::shared_ptr<Dropoff>> dropoffs;
+        EntityTable<Ship> ships;
+        EntityTable<Dropoff> dropoffs;
 
         Player(PlayerId player_id, int shipyard_x, int shipyard_y) :
             id(player_id),
-            shipyard(std::make_shared<Shipyard>(player_id, shipyard_x, shipyard_y)),
+            shipyard(player_id, shipyard_x, shipyard_y),
             halite(0)
         {}
 
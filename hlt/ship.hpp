@@ -4,8 +4,6 @@
 #include "constants.hpp"
 #include "command.hpp"
 
-#include <memory>
-
 namespace hlt {
     struct Ship : Entity {
         Halite halite;
@@ -31,6 +29,6 @@ namespace hlt {
             return hlt::command::move(id, Direction::STILL);
         }
 
-        static std::shared_ptr<Ship> _generate(PlayerId player_id);
+        static Ship _generate(PlayerId player_id);
     };
 }